@@ -0,0 +1,71 @@
+
+#ifndef FMI4CPP_BENCHMARK_UTIL_HPP
+#define FMI4CPP_BENCHMARK_UTIL_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <string>
+
+#if defined(__linux__) || defined(__APPLE__)
+#    include <sys/resource.h>
+#endif
+
+namespace
+{
+
+template<typename function>
+inline double measure_time_sec(function&& fun)
+{
+    auto t_start = std::chrono::steady_clock::now();
+    fun();
+    auto t_stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(t_stop - t_start).count();
+}
+
+/**
+ * Peak resident set size of this process in KiB, or 0 when the platform does not report it.
+ */
+inline size_t peak_rss_kib()
+{
+#if defined(__linux__)
+    // VmHWM honours reset_peak_rss(), the value reported by getrusage does not
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, 6, "VmHWM:") == 0) {
+            return std::stoul(line.substr(6));
+        }
+    }
+#endif
+#if defined(__linux__) || defined(__APPLE__)
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+#    if defined(__APPLE__)
+    return static_cast<size_t>(usage.ru_maxrss) / 1024;
+#    else
+    return static_cast<size_t>(usage.ru_maxrss);
+#    endif
+#else
+    return 0;
+#endif
+}
+
+/**
+ * Resets the peak resident set size to the current one, where supported (Linux 4.0+).
+ * Returns false if the peak could not be reset.
+ */
+inline bool reset_peak_rss()
+{
+#if defined(__linux__)
+    std::ofstream clearRefs("/proc/self/clear_refs");
+    clearRefs << "5";
+    return static_cast<bool>(clearRefs.flush());
+#else
+    return false;
+#endif
+}
+
+} // namespace
+
+#endif //FMI4CPP_BENCHMARK_UTIL_HPP
@@ -0,0 +1,45 @@
+#include "synthetic_model_description.hpp"
+
+#include <cstdio>
+#include <iostream>
+#include <string>
+
+namespace
+{
+
+type_mix parse_type_mix(const std::string& str)
+{
+    type_mix mix;
+    if (std::sscanf(str.c_str(), "%lf:%lf:%lf:%lf:%lf", &mix.real, &mix.integer, &mix.boolean, &mix.string, &mix.enumeration) != 5) {
+        throw std::runtime_error("Type mix must be given as real:integer:boolean:string:enumeration, got '" + str + "'");
+    }
+    return mix;
+}
+
+} // namespace
+
+/**
+ * Usage: generate_model_description <output.xml> [variables] [alias density] [dependency density] [real:integer:boolean:string:enumeration]
+ *
+ * Writes a synthetic modelDescription.xml, e.g. for use with model_description_parsing.
+ */
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0]
+                  << " <output.xml> [variables] [alias density] [dependency density] [real:integer:boolean:string:enumeration]"
+                  << std::endl;
+        return 1;
+    }
+
+    synthetic_model_options options;
+    options.num_variables = argc > 2 ? std::stoul(argv[2]) : options.num_variables;
+    options.alias_density = argc > 3 ? std::stod(argv[3]) : options.alias_density;
+    options.dependency_density = argc > 4 ? std::stod(argv[4]) : options.dependency_density;
+    if (argc > 5) {
+        options.types = parse_type_mix(argv[5]);
+    }
+
+    write_synthetic_model_description(argv[1], options);
+    return 0;
+}
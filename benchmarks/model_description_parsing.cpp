@@ -0,0 +1,60 @@
+#include "benchmark_util.hpp"
+
+#include <fmi4cpp/fmi2/xml/model_description_parser.hpp>
+
+#include <iostream>
+#include <string>
+
+using namespace fmi4cpp;
+
+namespace
+{
+
+const std::string default_file = "../resources/fmus/2.0/cs/20sim/4.6.4.8004/ControlledTemperature/modelDescription.xml";
+
+template<typename parser>
+void run(const std::string& backend, const std::string& file, int iterations, parser&& parse)
+{
+    const bool peakReset = reset_peak_rss();
+    const size_t rssBefore = peak_rss_kib();
+
+    size_t numVariables = 0;
+    const double elapsed = measure_time_sec([&] {
+        for (int i = 0; i < iterations; i++) {
+            auto md = parse(file);
+            numVariables = md->model_variables->size();
+        }
+    });
+
+    std::cout << backend << ": " << numVariables << " variables, "
+              << (elapsed / iterations) * 1000 << " ms/parse, "
+              << "peak RSS " << peak_rss_kib() << " KiB";
+    if (peakReset) {
+        std::cout << " (+" << (peak_rss_kib() - rssBefore) << " KiB)";
+    }
+    std::cout << std::endl;
+}
+
+} // namespace
+
+/**
+ * Usage: model_description_parsing [dom|stream|all] [modelDescription.xml] [iterations]
+ *
+ * Peak RSS can only be attributed to a single backend when the peak can be reset between runs (Linux),
+ * otherwise run each backend in its own process.
+ */
+int main(int argc, char** argv)
+{
+    const std::string backend = argc > 1 ? argv[1] : "all";
+    const std::string file = argc > 2 ? argv[2] : default_file;
+    const int iterations = argc > 3 ? std::stoi(argv[3]) : 10;
+
+    if (backend == "dom" || backend == "all") {
+        run("dom", file, iterations, fmi2::parse_model_description);
+    }
+    if (backend == "stream" || backend == "all") {
+        run("stream", file, iterations, fmi2::parse_model_description_streaming);
+    }
+
+    return 0;
+}
@@ -0,0 +1,173 @@
+#include "benchmark_util.hpp"
+#include "synthetic_model_description.hpp"
+
+#include <fmi4cpp/fmi2/xml/model_description_parser.hpp>
+#include <fmi4cpp/fs_portability.hpp>
+
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace fmi4cpp;
+
+namespace
+{
+
+struct scenario
+{
+    std::string mix;
+    synthetic_model_options options;
+};
+
+const size_t num_lookups = 10000;
+
+/**
+ * Average latency of getByName, getByValueReference and find_by_prefix in ns, over randomly picked keys.
+ */
+void measure_lookups(const fmi2::model_variables& variables, std::ostream& out)
+{
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<size_t> pick(0, variables.size() - 1);
+
+    std::vector<std::string> names;
+    std::vector<fmi2ValueReference> vrs;
+    std::vector<std::string> prefixes;
+    for (size_t i = 0; i < num_lookups; i++) {
+        const auto index = pick(rng);
+        names.push_back(variables[index].name);
+        vrs.push_back(variables[index].value_reference);
+        prefixes.push_back("block" + std::to_string(index / 100) + ".");
+    }
+
+    size_t sink = 0;
+    const double byName = measure_time_sec([&] {
+        for (const auto& name : names) {
+            sink += variables.getByName(name).value_reference;
+        }
+    });
+    const double byVr = measure_time_sec([&] {
+        for (const auto vr : vrs) {
+            sink += variables.getByValueReference(vr).value_reference;
+        }
+    });
+    const double byPrefix = measure_time_sec([&] {
+        for (const auto& prefix : prefixes) {
+            sink += variables.find_by_prefix(prefix).size();
+        }
+    });
+
+    const auto ns = [](double sec) { return sec / num_lookups * 1e9; };
+    out << std::setw(10) << ns(byName) << std::setw(10) << ns(byVr) << std::setw(12) << ns(byPrefix);
+    if (sink == 0) {
+        out << " (no lookups)";
+    }
+}
+
+template<typename parser>
+void run(const std::string& backend, const std::string& file, int iterations, parser&& parse)
+{
+    const bool peakReset = reset_peak_rss();
+    const size_t rssBefore = peak_rss_kib();
+
+    std::unique_ptr<const fmi2::model_description> md;
+    const double elapsed = measure_time_sec([&] {
+        for (int i = 0; i < iterations; i++) {
+            md.reset();
+            md = parse(file);
+        }
+    });
+
+    std::cout << std::setw(8) << backend << std::setw(12) << (elapsed / iterations) * 1000;
+    if (peakReset) {
+        std::cout << std::setw(12) << (peak_rss_kib() - rssBefore);
+    } else {
+        std::cout << std::setw(12) << peak_rss_kib();
+    }
+    measure_lookups(*md->model_variables, std::cout);
+    std::cout << std::endl;
+}
+
+std::vector<scenario> make_scenarios(size_t maxVariables)
+{
+    const type_mix realOnly{1.0, 0.0, 0.0, 0.0, 0.0};
+    const type_mix mixed{};
+    const type_mix discrete{0.0, 0.4, 0.4, 0.1, 0.1};
+
+    std::vector<scenario> scenarios;
+    const auto add = [&](const std::string& mix, const type_mix& types, size_t n, double aliases, double dependencies) {
+        if (n > maxVariables) {
+            return;
+        }
+        synthetic_model_options options;
+        options.num_variables = n;
+        options.types = types;
+        options.alias_density = aliases;
+        options.dependency_density = dependencies;
+        scenarios.push_back({mix, options});
+    };
+
+    // number of variables
+    for (size_t n = 1000; n <= 1000000; n *= 10) {
+        add("mixed", mixed, n, 0.05, 0.0);
+    }
+    // share of each type
+    add("real", realOnly, 100000, 0.05, 0.0);
+    add("discrete", discrete, 100000, 0.05, 0.0);
+    // alias density
+    add("mixed", mixed, 100000, 0.2, 0.0);
+    add("mixed", mixed, 100000, 0.5, 0.0);
+    // ModelStructure dependency density
+    add("mixed", mixed, 10000, 0.05, 0.001);
+    add("mixed", mixed, 10000, 0.05, 0.01);
+    add("mixed", mixed, 10000, 0.05, 0.1);
+
+    return scenarios;
+}
+
+} // namespace
+
+/**
+ * Usage: model_description_scaling [max variables] [iterations] [dom|stream|all]
+ *
+ * Parses synthetic model descriptions of growing size and shape, reporting per parse the time,
+ * the peak RSS increase (or the absolute peak where it cannot be reset) and the average
+ * latency of name, value reference and prefix lookups through model_variables.
+ */
+int main(int argc, char** argv)
+{
+    const size_t maxVariables = argc > 1 ? std::stoul(argv[1]) : 1000000;
+    const int iterations = argc > 2 ? std::stoi(argv[2]) : 3;
+    const std::string backend = argc > 3 ? argv[3] : "all";
+
+    std::cout << std::fixed << std::setprecision(1)
+              << std::setw(9) << "variables" << std::setw(10) << "mix" << std::setw(8) << "aliases"
+              << std::setw(8) << "deps" << std::setw(10) << "file MiB"
+              << std::setw(8) << "parser" << std::setw(12) << "ms/parse" << std::setw(12) << "RSS KiB"
+              << std::setw(10) << "name ns" << std::setw(10) << "vr ns" << std::setw(12) << "prefix ns" << std::endl;
+
+    const auto file = (fs::temp_directory_path() / "fmi4cpp_synthetic_modelDescription.xml").string();
+    for (const auto& s : make_scenarios(maxVariables)) {
+        write_synthetic_model_description(file, s.options);
+        const auto mib = static_cast<double>(fs::file_size(file)) / (1024 * 1024);
+
+        const auto prefix = [&] {
+            std::cout << std::setw(9) << s.options.num_variables << std::setw(10) << s.mix
+                      << std::defaultfloat << std::setw(8) << s.options.alias_density << std::setw(8) << s.options.dependency_density
+                      << std::fixed << std::setw(10) << mib;
+        };
+        if (backend == "dom" || backend == "all") {
+            prefix();
+            run("dom", file, iterations, fmi2::parse_model_description);
+        }
+        if (backend == "stream" || backend == "all") {
+            prefix();
+            run("stream", file, iterations, fmi2::parse_model_description_streaming);
+        }
+    }
+    fs::remove(file);
+
+    return 0;
+}
@@ -0,0 +1,242 @@
+
+#ifndef FMI4CPP_SYNTHETIC_MODEL_DESCRIPTION_HPP
+#define FMI4CPP_SYNTHETIC_MODEL_DESCRIPTION_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+/**
+ * Relative share of each base type among the generated variables. The shares need not add up to one.
+ */
+struct type_mix
+{
+    double real = 0.6;
+    double integer = 0.2;
+    double boolean = 0.1;
+    double string = 0.05;
+    double enumeration = 0.05;
+};
+
+struct synthetic_model_options
+{
+    size_t num_variables = 1000;
+    type_mix types;
+
+    // probability that a variable is an alias of an earlier variable of the same base type
+    double alias_density = 0.0;
+
+    // fraction of the states and inputs each output and derivative depends on
+    double dependency_density = 0.0;
+
+    unsigned int seed = 42;
+};
+
+/**
+ * Writes a valid FMI 2.0 co-simulation modelDescription.xml with the requested shape.
+ *
+ * Variables are named "block<i/100>.<type><i>", so prefix lookups match blocks of 100 variables.
+ * About a tenth of the variables are inputs, outputs and parameters each, and about a tenth of
+ * the Real variables are state derivatives, with the state declared right before them.
+ * Reals get a unit from the UnitDefinitions and Enumerations a declared type from the TypeDefinitions.
+ */
+inline void write_synthetic_model_description(const std::string& fileName, const synthetic_model_options& options)
+{
+    enum class type
+    {
+        real,
+        integer,
+        boolean,
+        string,
+        enumeration
+    };
+    const char* typeNames[] = {"Real", "Integer", "Boolean", "String", "Enumeration"};
+    const char* units[] = {"m", "s", "kg", "K", "m/s"};
+
+    std::ofstream out(fileName, std::ios::binary);
+    if (!out) {
+        throw std::runtime_error("Unable to write " + fileName);
+    }
+
+    std::mt19937 rng(options.seed);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    std::discrete_distribution<int> pickType({options.types.real, options.types.integer, options.types.boolean,
+        options.types.string, options.types.enumeration});
+
+    out << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        << "<fmiModelDescription fmiVersion=\"2.0\" modelName=\"Synthetic\" "
+        << "guid=\"{00000000-0000-0000-0000-" << options.num_variables << "}\" "
+        << "generationTool=\"fmi4cpp benchmarks\" variableNamingConvention=\"structured\" numberOfEventIndicators=\"0\">\n"
+        << "  <CoSimulation modelIdentifier=\"Synthetic\" canHandleVariableCommunicationStepSize=\"true\"/>\n"
+        << "  <UnitDefinitions>\n"
+        << "    <Unit name=\"m\"><BaseUnit m=\"1\"/><DisplayUnit name=\"mm\" factor=\"1000\"/></Unit>\n"
+        << "    <Unit name=\"s\"><BaseUnit s=\"1\"/></Unit>\n"
+        << "    <Unit name=\"kg\"><BaseUnit kg=\"1\"/></Unit>\n"
+        << "    <Unit name=\"K\"><BaseUnit K=\"1\"/><DisplayUnit name=\"degC\" offset=\"-273.15\"/></Unit>\n"
+        << "    <Unit name=\"m/s\"><BaseUnit m=\"1\" s=\"-1\"/></Unit>\n"
+        << "  </UnitDefinitions>\n"
+        << "  <TypeDefinitions>\n"
+        << "    <SimpleType name=\"Mode\">\n"
+        << "      <Enumeration>\n"
+        << "        <Item name=\"off\" value=\"1\"/>\n"
+        << "        <Item name=\"on\" value=\"2\"/>\n"
+        << "        <Item name=\"fault\" value=\"3\"/>\n"
+        << "      </Enumeration>\n"
+        << "    </SimpleType>\n"
+        << "  </TypeDefinitions>\n"
+        << "  <DefaultExperiment startTime=\"0\" stopTime=\"10\" stepSize=\"0.01\"/>\n"
+        << "  <ModelVariables>\n";
+
+    // value references are handed out per base type, aliases reuse an earlier one of the same type
+    unsigned int nextVr[5] = {0, 0, 0, 0, 0};
+    std::vector<unsigned int> vrs[5];
+
+    std::vector<size_t> outputs;
+    std::vector<size_t> derivatives;
+    std::vector<size_t> independents; // states and inputs, the candidates for dependencies
+    size_t lastState = 0;
+
+    for (size_t i = 0; i < options.num_variables; i++) {
+        const auto t = static_cast<type>(pickType(rng));
+        const auto ti = static_cast<size_t>(t);
+        const size_t index = i + 1;
+
+        const bool alias = !vrs[ti].empty() && uniform(rng) < options.alias_density;
+        unsigned int vr;
+        if (alias) {
+            vr = vrs[ti][std::uniform_int_distribution<size_t>(0, vrs[ti].size() - 1)(rng)];
+        } else {
+            vr = nextVr[ti]++;
+            vrs[ti].push_back(vr);
+        }
+
+        const char* causality = "local";
+        const char* variability = t == type::real ? "continuous" : "discrete";
+        bool start = false;
+        bool isState = false;
+        bool isDerivative = false;
+
+        if (!alias) {
+            const double role = uniform(rng);
+            if (role < 0.1) {
+                causality = "input";
+                start = true;
+            } else if (role < 0.2) {
+                causality = "output";
+            } else if (role < 0.3) {
+                causality = "parameter";
+                variability = "fixed";
+                start = true;
+            } else if (t == type::real && role < 0.34) {
+                isState = true;
+                start = true;
+            } else if (t == type::real && role < 0.38 && lastState != 0) {
+                isDerivative = true;
+            }
+        }
+        if (t == type::string && std::string(variability) != "fixed") {
+            variability = "discrete";
+        }
+
+        out << "    <ScalarVariable name=\"block" << i / 100 << "." << typeNames[ti] << i << "\" "
+            << "valueReference=\"" << vr << "\" causality=\"" << causality << "\" variability=\"" << variability << "\"";
+        if (isState || (start && std::string(causality) == "parameter")) {
+            out << " initial=\"exact\"";
+        }
+        out << " description=\"synthetic variable " << i << "\">\n      <" << typeNames[ti];
+
+        switch (t) {
+            case type::real:
+                out << " unit=\"" << units[i % 5] << "\"";
+                if (isDerivative) {
+                    out << " derivative=\"" << lastState << "\"";
+                }
+                if (start) {
+                    out << " start=\"" << uniform(rng) << "\"";
+                }
+                break;
+            case type::integer:
+                out << " min=\"0\" max=\"1000\"";
+                if (start) {
+                    out << " start=\"" << i % 1000 << "\"";
+                }
+                break;
+            case type::boolean:
+                if (start) {
+                    out << " start=\"" << (i % 2 ? "true" : "false") << "\"";
+                }
+                break;
+            case type::string:
+                if (start) {
+                    out << " start=\"value " << i << "\"";
+                }
+                break;
+            case type::enumeration:
+                out << " declaredType=\"Mode\"";
+                if (start) {
+                    out << " start=\"" << 1 + i % 3 << "\"";
+                }
+                break;
+        }
+        out << "/>\n    </ScalarVariable>\n";
+
+        if (std::string(causality) == "output") {
+            outputs.push_back(index);
+        }
+        if (std::string(causality) == "input") {
+            independents.push_back(index);
+        }
+        if (isState) {
+            independents.push_back(index);
+            lastState = index;
+        }
+        if (isDerivative) {
+            derivatives.push_back(index);
+            lastState = 0;
+        }
+    }
+
+    out << "  </ModelVariables>\n  <ModelStructure>\n";
+
+    std::bernoulli_distribution depends(std::clamp(options.dependency_density, 0.0, 1.0));
+    const auto write_unknowns = [&](const char* element, const std::vector<size_t>& unknowns) {
+        if (unknowns.empty()) {
+            return;
+        }
+        out << "    <" << element << ">\n";
+        for (const auto index : unknowns) {
+            out << "      <Unknown index=\"" << index << "\" dependencies=\"";
+            bool first = true;
+            if (options.dependency_density > 0.0) {
+                for (const auto candidate : independents) {
+                    if (depends(rng)) {
+                        out << (first ? "" : " ") << candidate;
+                        first = false;
+                    }
+                }
+            }
+            out << "\"/>\n";
+        }
+        out << "    </" << element << ">\n";
+    };
+    write_unknowns("Outputs", outputs);
+    write_unknowns("Derivatives", derivatives);
+    write_unknowns("InitialUnknowns", outputs);
+
+    out << "  </ModelStructure>\n</fmiModelDescription>\n";
+
+    if (!out.flush()) {
+        throw std::runtime_error("Unable to write " + fileName);
+    }
+}
+
+} // namespace
+
+#endif //FMI4CPP_SYNTHETIC_MODEL_DESCRIPTION_HPP
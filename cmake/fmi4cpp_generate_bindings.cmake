@@ -0,0 +1,41 @@
+# fmi4cpp_generate_bindings(<target>
+#     MODEL_DESCRIPTION <modelDescription.xml or .fmu>
+#     NAMESPACE <namespace>
+#     [HEADER <output header>])
+#
+# Generates a header with typed value references and per-type value reference groups
+# from the model description at build time, and makes it available to <target>.
+# HEADER defaults to <namespace>.hpp in a directory added to the include path of <target>.
+function(fmi4cpp_generate_bindings target)
+    cmake_parse_arguments(arg "" "MODEL_DESCRIPTION;NAMESPACE;HEADER" "" ${ARGN})
+    if (NOT arg_MODEL_DESCRIPTION OR NOT arg_NAMESPACE)
+        message(FATAL_ERROR "fmi4cpp_generate_bindings: MODEL_DESCRIPTION and NAMESPACE are required")
+    endif ()
+
+    if (TARGET fmi4cpp_codegen)
+        set(codegen fmi4cpp_codegen)
+    elseif (TARGET fmi4cpp::fmi4cpp_codegen)
+        set(codegen fmi4cpp::fmi4cpp_codegen)
+    else ()
+        message(FATAL_ERROR "fmi4cpp_generate_bindings: fmi4cpp_codegen not found, build fmi4cpp with FMI4CPP_BUILD_TOOLS=ON")
+    endif ()
+
+    get_filename_component(modelDescription "${arg_MODEL_DESCRIPTION}" ABSOLUTE)
+    if (arg_HEADER)
+        get_filename_component(header "${arg_HEADER}" ABSOLUTE BASE_DIR "${CMAKE_CURRENT_BINARY_DIR}")
+    else ()
+        set(header "${CMAKE_CURRENT_BINARY_DIR}/fmi4cpp_bindings/${arg_NAMESPACE}.hpp")
+    endif ()
+    get_filename_component(headerDir "${header}" DIRECTORY)
+
+    add_custom_command(
+        OUTPUT "${header}"
+        COMMAND ${CMAKE_COMMAND} -E make_directory "${headerDir}"
+        COMMAND ${codegen} "${modelDescription}" "${header}" "${arg_NAMESPACE}"
+        DEPENDS "${modelDescription}" ${codegen}
+        COMMENT "Generating FMU bindings ${header}"
+        VERBATIM
+    )
+    target_sources(${target} PRIVATE "${header}")
+    target_include_directories(${target} PRIVATE "${headerDir}")
+endfunction()
@@ -0,0 +1,45 @@
+#include <controlled_temperature.hpp>
+#include <fmi4cpp/fmi4cpp.hpp>
+
+#include <iostream>
+
+using namespace fmi4cpp;
+
+const double stop = 10.0;
+const double step_size = 1E-4;
+
+int main()
+{
+    const std::string fmu_path = "../resources/fmus/2.0/cs/20sim/4.6.4.8004/"
+                                 "ControlledTemperature/ControlledTemperature.fmu";
+
+    auto fmu = fmi2::fmu(fmu_path).as_cs_fmu();
+    if (fmu->get_model_description()->guid != controlled_temperature::guid) {
+        std::cerr << "Error! The bindings were generated for a different FMU" << std::endl;
+        return 1;
+    }
+
+    auto slave = fmu->new_instance();
+    slave->setup_experiment();
+    slave->enter_initialization_mode();
+    write(*slave, controlled_temperature::vr::HeatCapacity1_T0, 300.0);
+    slave->exit_initialization_mode();
+
+    controlled_temperature::outputs::values outputs{};
+    while ((slave->get_simulation_time()) <= (stop - step_size)) {
+        if (!slave->step(step_size)) {
+            std::cerr << "Error! step returned with status: " << to_string(slave->last_status()) << std::endl;
+            break;
+        }
+        if (!controlled_temperature::outputs::read(*slave, outputs)) {
+            std::cerr << "Error! read_real returned with status: " << to_string(slave->last_status()) << std::endl;
+            break;
+        }
+    }
+
+    std::cout << "Temperature_Room=" << outputs.Temperature_Room << std::endl;
+
+    slave->terminate();
+
+    return 0;
+}
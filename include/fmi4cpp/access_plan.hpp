@@ -0,0 +1,164 @@
+
+#ifndef FMI4CPP_ACCESSPLAN_HPP
+#define FMI4CPP_ACCESSPLAN_HPP
+
+#include <fmi4cpp/typed_access.hpp>
+#include <fmi4cpp/types.hpp>
+#include <fmi4cpp/value_reference_set.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace fmi4cpp
+{
+
+/**
+ * Where the value of a signal is kept in an access_plan: the base type, and the position among values of that type.
+ */
+struct signal_slot
+{
+    base_type type;
+    size_t index;
+};
+
+/**
+ * A fixed set of signals that is read or written repeatedly, e.g. the outputs and inputs of every step.
+ *
+ * Built once, the plan groups the value references by base type, sorts them and drops duplicates,
+ * and preallocates one contiguous value buffer per type. Reading or writing the plan through an instance
+ * then costs one call into the FMU per base type, without lookups or allocations.
+ * Signals are numbered in the order they were given, and several signals may share a slot.
+ */
+class access_plan
+{
+
+private:
+    value_reference_set valueReferences_;
+    std::vector<signal_slot> slots_;
+
+    std::vector<fmi4cppInteger> integers_;
+    std::vector<fmi4cppReal> reals_;
+    std::vector<fmi4cppBoolean> booleans_;
+    std::vector<fmi4cppString> strings_;
+
+    std::vector<fmi4cppValueReference>& vrs_of(base_type type)
+    {
+        switch (type) {
+            case base_type::integer: return valueReferences_.integers;
+            case base_type::real: return valueReferences_.reals;
+            case base_type::boolean: return valueReferences_.booleans;
+            default: return valueReferences_.strings;
+        }
+    }
+
+public:
+    access_plan() = default;
+
+    explicit access_plan(const std::vector<std::pair<base_type, fmi4cppValueReference>>& signals)
+    {
+        for (const auto& [type, vr] : signals) {
+            vrs_of(type).push_back(vr);
+        }
+        for (auto* vrs : {&valueReferences_.integers, &valueReferences_.reals, &valueReferences_.booleans, &valueReferences_.strings}) {
+            std::sort(vrs->begin(), vrs->end());
+            vrs->erase(std::unique(vrs->begin(), vrs->end()), vrs->end());
+        }
+
+        slots_.reserve(signals.size());
+        for (const auto& [type, vr] : signals) {
+            const auto& vrs = vrs_of(type);
+            const auto index = static_cast<size_t>(std::lower_bound(vrs.begin(), vrs.end(), vr) - vrs.begin());
+            slots_.push_back({type, index});
+        }
+
+        integers_.resize(valueReferences_.integers.size());
+        reals_.resize(valueReferences_.reals.size());
+        booleans_.resize(valueReferences_.booleans.size());
+        strings_.resize(valueReferences_.strings.size(), "");
+    }
+
+    /**
+     * Plan for all value references in set, numbered integers first, then reals, booleans and strings.
+     */
+    explicit access_plan(const value_reference_set& set)
+        : access_plan([&set] {
+            std::vector<std::pair<base_type, fmi4cppValueReference>> signals;
+            signals.reserve(set.size());
+            for (const auto vr : set.integers) signals.emplace_back(base_type::integer, vr);
+            for (const auto vr : set.reals) signals.emplace_back(base_type::real, vr);
+            for (const auto vr : set.booleans) signals.emplace_back(base_type::boolean, vr);
+            for (const auto vr : set.strings) signals.emplace_back(base_type::string, vr);
+            return signals;
+        }())
+    {}
+
+    /**
+     * Number of signals, which may be more than the number of value references when some are shared.
+     */
+    [[nodiscard]] size_t size() const
+    {
+        return slots_.size();
+    }
+
+    [[nodiscard]] const signal_slot& slot(size_t signal) const
+    {
+        return slots_[signal];
+    }
+
+    /**
+     * The sorted, de-duplicated value references of each base type.
+     */
+    [[nodiscard]] const value_reference_set& value_references() const
+    {
+        return valueReferences_;
+    }
+
+    /**
+     * The value buffer of a base type, in the order of value_references().
+     */
+    template<base_type Type>
+    [[nodiscard]] std::vector<typename base_type_traits<Type>::value_type>& values()
+    {
+        if constexpr (Type == base_type::integer) {
+            return integers_;
+        } else if constexpr (Type == base_type::real) {
+            return reals_;
+        } else if constexpr (Type == base_type::boolean) {
+            return booleans_;
+        } else {
+            return strings_;
+        }
+    }
+
+    template<base_type Type>
+    [[nodiscard]] const std::vector<typename base_type_traits<Type>::value_type>& values() const
+    {
+        return const_cast<access_plan*>(this)->values<Type>();
+    }
+
+    /**
+     * The value of a signal, which must be of the given base type.
+     */
+    template<base_type Type>
+    typename base_type_traits<Type>::value_type& value(size_t signal)
+    {
+        const auto& slot = slots_.at(signal);
+        if (slot.type != Type) {
+            throw std::runtime_error("Signal " + std::to_string(signal) + " is of another base type");
+        }
+        return values<Type>()[slot.index];
+    }
+
+    template<base_type Type>
+    [[nodiscard]] typename base_type_traits<Type>::value_type value(size_t signal) const
+    {
+        return const_cast<access_plan*>(this)->value<Type>(signal);
+    }
+};
+
+} // namespace fmi4cpp
+
+#endif //FMI4CPP_ACCESSPLAN_HPP
@@ -0,0 +1,49 @@
+
+#ifndef FMI4CPP_CONVERSIONS_HPP
+#define FMI4CPP_CONVERSIONS_HPP
+
+#include <fmi4cpp/types.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace fmi4cpp
+{
+
+// Conversions between the int sized Boolean and Integer values of FMI and compact user types,
+// for moving discrete signals to and from bit-packed or narrow buffers. They use SSE2 or AVX2
+// where the library is compiled for it, and plain loops otherwise.
+// Booleans are true when non-zero, and come out as 0 or 1.
+
+void booleans_to_bytes(const fmi4cppBoolean* values, size_t n, uint8_t* bytes);
+void bytes_to_booleans(const uint8_t* bytes, size_t n, fmi4cppBoolean* values);
+
+inline void booleans_to_bytes(const fmi4cppBoolean* values, size_t n, bool* bytes)
+{
+    static_assert(sizeof(bool) == sizeof(uint8_t));
+    booleans_to_bytes(values, n, reinterpret_cast<uint8_t*>(bytes));
+}
+
+inline void bytes_to_booleans(const bool* bytes, size_t n, fmi4cppBoolean* values)
+{
+    bytes_to_booleans(reinterpret_cast<const uint8_t*>(bytes), n, values);
+}
+
+/**
+ * Packs n Booleans into bits, value i going to bit i % 64 of bits[i / 64]. Unused bits of the last word are cleared.
+ */
+void booleans_to_bits(const fmi4cppBoolean* values, size_t n, uint64_t* bits);
+void bits_to_booleans(const uint64_t* bits, size_t n, fmi4cppBoolean* values);
+
+/**
+ * Narrows Integers, saturating values outside the range of the target type.
+ */
+void narrow_integers(const fmi4cppInteger* values, size_t n, int16_t* narrowed);
+void narrow_integers(const fmi4cppInteger* values, size_t n, int8_t* narrowed);
+
+void widen_integers(const int16_t* narrowed, size_t n, fmi4cppInteger* values);
+void widen_integers(const int8_t* narrowed, size_t n, fmi4cppInteger* values);
+
+} // namespace fmi4cpp
+
+#endif //FMI4CPP_CONVERSIONS_HPP
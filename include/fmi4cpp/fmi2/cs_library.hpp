@@ -10,19 +10,6 @@ namespace fmi4cpp::fmi2
 class cs_library : public fmi2_library
 {
 
-private:
-    fmi2SetRealInputDerivativesTYPE* fmi2SetRealInputDerivatives_;
-    fmi2GetRealOutputDerivativesTYPE* fmi2GetRealOutputDerivatives_;
-
-    fmi2DoStepTYPE* fmi2DoStep_;
-    fmi2CancelStepTYPE* fmi2CancelStep_;
-
-    fmi2GetStatusTYPE* fmi2GetStatus_;
-    fmi2GetRealStatusTYPE* fmi2GetRealStatus_;
-    fmi2GetIntegerStatusTYPE* fmi2GetIntegerStatus_;
-    fmi2GetBooleanStatusTYPE* fmi2GetBooleanStatus_;
-    fmi2GetStringStatusTYPE* fmi2GetStringStatus_;
-
 public:
     cs_library(
         const std::string& modelIdentifier,
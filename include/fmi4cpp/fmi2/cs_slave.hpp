@@ -3,11 +3,14 @@
 #define FMI4CPP_FMI2_CS_SLAVE_HPP
 
 #include <fmi4cpp/fmi2/cs_library.hpp>
+#include <fmi4cpp/fmi2/cs_slave_handle.hpp>
 #include <fmi4cpp/fmi2/fmi2TypesPlatform.h>
 #include <fmi4cpp/fmi2/xml/model_description.hpp>
 #include <fmi4cpp/fmu_instance_base.hpp>
 #include <fmi4cpp/fmu_resource.hpp>
 #include <fmi4cpp/fmu_slave.hpp>
+#include <fmi4cpp/value_cache.hpp>
+#include <fmi4cpp/write_buffer.hpp>
 
 #include <memory>
 
@@ -19,12 +22,64 @@ class cs_slave : public virtual fmu_slave<cs_model_description>,
                  public fmu_instance_base<cs_library, cs_model_description>
 {
 
+private:
+    cs_slave_handle fastPath_;
+    std::unique_ptr<value_cache> cache_;
+    std::unique_ptr<write_buffer> writeBuffer_;
+
+    void prefetch();
+
 public:
     cs_slave(fmi2Component c,
         const std::shared_ptr<fmu_resource>& resource,
         const std::shared_ptr<cs_library>& library,
         const std::shared_ptr<const cs_model_description>& modelDescription);
 
+    /**
+     * Direct access to stepping and variables, bypassing virtual dispatch. See cs_slave_handle.
+     */
+    [[nodiscard]] cs_slave_handle& fast_path()
+    {
+        return fastPath_;
+    }
+
+    /**
+     * Serve repeated reads of Integer, Real and Boolean values from memory until the next step or write.
+     * Values are cached as they are read, except those in eager, which are read right after every step.
+     * Writes through fast_path() bypass the cache, and must be followed by invalidate_cache().
+     */
+    void enable_cache(value_reference_set eager = {});
+    void disable_cache();
+    void invalidate_cache();
+
+    [[nodiscard]] bool cache_enabled() const
+    {
+        return cache_ != nullptr;
+    }
+
+    /**
+     * Hold back writes until the next step, enter_initialization_mode, exit_initialization_mode or flush(),
+     * and pass them on as one call per base type, keeping only the last write to each value reference.
+     * Reads, FMU state snapshots and directional derivatives flush first, while reset and set_fmu_state drop pending writes.
+     * Writes through fast_path() are not buffered.
+     */
+    void enable_write_buffering();
+
+    /**
+     * Flushes pending writes and writes through from then on.
+     */
+    bool disable_write_buffering();
+
+    [[nodiscard]] bool write_buffering_enabled() const
+    {
+        return writeBuffer_ != nullptr;
+    }
+
+    /**
+     * Passes pending writes on to the FMU.
+     */
+    bool flush();
+
     bool step(double stepSize) override;
     bool cancel_step() override;
 
@@ -42,27 +97,35 @@ public:
 
     bool read_integer(fmi2ValueReference vr, fmi2Integer& ref) override;
     bool read_integer(const std::vector<fmi2ValueReference>& vr, std::vector<fmi2Integer>& ref) override;
+    bool read_integer(const fmi2ValueReference* vr, size_t nvr, fmi2Integer* ref) override;
 
     bool read_real(fmi2ValueReference vr, fmi2Real& ref) override;
     bool read_real(const std::vector<fmi2ValueReference>& vr, std::vector<fmi2Real>& ref) override;
+    bool read_real(const fmi2ValueReference* vr, size_t nvr, fmi2Real* ref) override;
 
     bool read_string(fmi2ValueReference vr, fmi2String& ref) override;
     bool read_string(const std::vector<fmi2ValueReference>& vr, std::vector<fmi2String>& ref) override;
+    bool read_string(const fmi2ValueReference* vr, size_t nvr, fmi2String* ref) override;
 
     bool read_boolean(fmi2ValueReference vr, fmi2Boolean& ref) override;
     bool read_boolean(const std::vector<fmi2ValueReference>& vr, std::vector<fmi2Boolean>& ref) override;
+    bool read_boolean(const fmi2ValueReference* vr, size_t nvr, fmi2Boolean* ref) override;
 
     bool write_integer(fmi2ValueReference vr, fmi2Integer value) override;
     bool write_integer(const std::vector<fmi2ValueReference>& vr, const std::vector<fmi2Integer>& values) override;
+    bool write_integer(const fmi2ValueReference* vr, size_t nvr, const fmi2Integer* values) override;
 
     bool write_real(fmi2ValueReference vr, fmi2Real value) override;
     bool write_real(const std::vector<fmi2ValueReference>& vr, const std::vector<fmi2Real>& values) override;
+    bool write_real(const fmi2ValueReference* vr, size_t nvr, const fmi2Real* values) override;
 
     bool write_string(fmi2ValueReference vr, fmi2String value) override;
     bool write_string(const std::vector<fmi2ValueReference>& vr, const std::vector<fmi2String>& values) override;
+    bool write_string(const fmi2ValueReference* vr, size_t nvr, const fmi2String* values) override;
 
     bool write_boolean(fmi2ValueReference vr, fmi2Boolean value) override;
     bool write_boolean(const std::vector<fmi2ValueReference>& vr, const std::vector<fmi2Boolean>& values) override;
+    bool write_boolean(const fmi2ValueReference* vr, size_t nvr, const fmi2Boolean* values) override;
 
 
     bool get_fmu_state(fmi2FMUstate& state) override;
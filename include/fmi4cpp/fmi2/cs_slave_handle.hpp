@@ -0,0 +1,169 @@
+
+#ifndef FMI4CPP_FMI2_CS_SLAVE_HANDLE_HPP
+#define FMI4CPP_FMI2_CS_SLAVE_HANDLE_HPP
+
+#include <fmi4cpp/fmi2/cs_library.hpp>
+
+#include <cstddef>
+
+namespace fmi4cpp::fmi2
+{
+
+/**
+ * Direct access to a co-simulation slave, for FMUs with step times where call overhead matters.
+ *
+ * Holds the component and the FMI functions it needs, so every call is a single inline call
+ * through a function pointer, without virtual dispatch or library indirection. Status and
+ * simulation time are shared with the cs_slave the handle belongs to, whose polymorphic
+ * functions call through the handle as well. A handle must not be used after its slave is terminated.
+ */
+class cs_slave_handle final
+{
+
+private:
+    fmi2Component c_;
+    fmi2Status* lastStatus_;
+    double* simulationTime_;
+
+    fmi2DoStepTYPE* doStep_;
+
+    fmi2GetIntegerTYPE* getInteger_;
+    fmi2GetRealTYPE* getReal_;
+    fmi2GetStringTYPE* getString_;
+    fmi2GetBooleanTYPE* getBoolean_;
+
+    fmi2SetIntegerTYPE* setInteger_;
+    fmi2SetRealTYPE* setReal_;
+    fmi2SetStringTYPE* setString_;
+    fmi2SetBooleanTYPE* setBoolean_;
+
+    bool ok(fmi2Status status)
+    {
+        *lastStatus_ = status;
+        return status == fmi2OK;
+    }
+
+public:
+    cs_slave_handle(fmi2Component c, cs_library& library, double& simulationTime)
+        : c_(c)
+        , lastStatus_(&static_cast<fmi2_library&>(library).lastStatus_)
+        , simulationTime_(&simulationTime)
+        , doStep_(library.functions().do_step)
+        , getInteger_(library.functions().get_integer)
+        , getReal_(library.functions().get_real)
+        , getString_(library.functions().get_string)
+        , getBoolean_(library.functions().get_boolean)
+        , setInteger_(library.functions().set_integer)
+        , setReal_(library.functions().set_real)
+        , setString_(library.functions().set_string)
+        , setBoolean_(library.functions().set_boolean)
+    {}
+
+    [[nodiscard]] fmi2Component component() const
+    {
+        return c_;
+    }
+
+    [[nodiscard]] double simulation_time() const
+    {
+        return *simulationTime_;
+    }
+
+    [[nodiscard]] fmi2Status last_status() const
+    {
+        return *lastStatus_;
+    }
+
+    bool step(double stepSize)
+    {
+        if (ok(doStep_(c_, *simulationTime_, stepSize, fmi2False))) {
+            *simulationTime_ += stepSize;
+            return true;
+        }
+        return false;
+    }
+
+    bool get_integer(fmi2ValueReference vr, fmi2Integer& ref)
+    {
+        return ok(getInteger_(c_, &vr, 1, &ref));
+    }
+
+    bool get_integer(const fmi2ValueReference* vr, size_t nvr, fmi2Integer* ref)
+    {
+        return ok(getInteger_(c_, vr, nvr, ref));
+    }
+
+    bool get_real(fmi2ValueReference vr, fmi2Real& ref)
+    {
+        return ok(getReal_(c_, &vr, 1, &ref));
+    }
+
+    bool get_real(const fmi2ValueReference* vr, size_t nvr, fmi2Real* ref)
+    {
+        return ok(getReal_(c_, vr, nvr, ref));
+    }
+
+    bool get_string(fmi2ValueReference vr, fmi2String& ref)
+    {
+        return ok(getString_(c_, &vr, 1, &ref));
+    }
+
+    bool get_string(const fmi2ValueReference* vr, size_t nvr, fmi2String* ref)
+    {
+        return ok(getString_(c_, vr, nvr, ref));
+    }
+
+    bool get_boolean(fmi2ValueReference vr, fmi2Boolean& ref)
+    {
+        return ok(getBoolean_(c_, &vr, 1, &ref));
+    }
+
+    bool get_boolean(const fmi2ValueReference* vr, size_t nvr, fmi2Boolean* ref)
+    {
+        return ok(getBoolean_(c_, vr, nvr, ref));
+    }
+
+    bool set_integer(fmi2ValueReference vr, fmi2Integer value)
+    {
+        return ok(setInteger_(c_, &vr, 1, &value));
+    }
+
+    bool set_integer(const fmi2ValueReference* vr, size_t nvr, const fmi2Integer* values)
+    {
+        return ok(setInteger_(c_, vr, nvr, values));
+    }
+
+    bool set_real(fmi2ValueReference vr, fmi2Real value)
+    {
+        return ok(setReal_(c_, &vr, 1, &value));
+    }
+
+    bool set_real(const fmi2ValueReference* vr, size_t nvr, const fmi2Real* values)
+    {
+        return ok(setReal_(c_, vr, nvr, values));
+    }
+
+    bool set_string(fmi2ValueReference vr, fmi2String value)
+    {
+        return ok(setString_(c_, &vr, 1, &value));
+    }
+
+    bool set_string(const fmi2ValueReference* vr, size_t nvr, const fmi2String* values)
+    {
+        return ok(setString_(c_, vr, nvr, values));
+    }
+
+    bool set_boolean(fmi2ValueReference vr, fmi2Boolean value)
+    {
+        return ok(setBoolean_(c_, &vr, 1, &value));
+    }
+
+    bool set_boolean(const fmi2ValueReference* vr, size_t nvr, const fmi2Boolean* values)
+    {
+        return ok(setBoolean_(c_, vr, nvr, values));
+    }
+};
+
+} // namespace fmi4cpp::fmi2
+
+#endif //FMI4CPP_FMI2_CS_SLAVE_HANDLE_HPP
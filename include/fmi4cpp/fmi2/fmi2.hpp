@@ -5,6 +5,7 @@
 #include <fmi4cpp/fmi2/cs_fmu.hpp>
 #include <fmi4cpp/fmi2/cs_slave.hpp>
 #include <fmi4cpp/fmi2/fmu.hpp>
+#include <fmi4cpp/fmi2/instance_group.hpp>
 #include <fmi4cpp/fmi2/me_fmu.hpp>
 #include <fmi4cpp/fmi2/xml/enums.hpp>
 #include <fmi4cpp/fmi2/xml/model_description.hpp>
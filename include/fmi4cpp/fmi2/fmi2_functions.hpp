@@ -0,0 +1,90 @@
+
+#ifndef FMI4CPP_FMI2_FUNCTIONS_HPP
+#define FMI4CPP_FMI2_FUNCTIONS_HPP
+
+#include <fmi4cpp/fmi2/fmi2FunctionTypes.h>
+
+namespace fmi4cpp::fmi2
+{
+
+/**
+ * The FMI functions resolved from the shared library of an FMU, for calling the C API directly.
+ *
+ * Functions the FMU does not export are null, as are the co-simulation functions of a model exchange
+ * library and the other way around. Calls made through the table bypass fmi4cpp entirely,
+ * so they neither update the last status nor any state kept by the instance, such as the simulation time.
+ *
+ * Each instance owns its own copy of the library, so the table also holds the component to pass to the functions.
+ */
+struct fmi2_functions
+{
+    // the instance created through this table, null before fmi2Instantiate and after fmi2FreeInstance
+    fmi2Component component = nullptr;
+
+    // the callbacks given to fmi2Instantiate
+    const fmi2CallbackFunctions* callbacks = nullptr;
+
+    fmi2GetVersionTYPE* get_version = nullptr;
+    fmi2GetTypesPlatformTYPE* get_types_platform = nullptr;
+
+    fmi2SetDebugLoggingTYPE* set_debug_logging = nullptr;
+
+    fmi2InstantiateTYPE* instantiate = nullptr;
+    fmi2SetupExperimentTYPE* setup_experiment = nullptr;
+    fmi2EnterInitializationModeTYPE* enter_initialization_mode = nullptr;
+    fmi2ExitInitializationModeTYPE* exit_initialization_mode = nullptr;
+
+    fmi2ResetTYPE* reset = nullptr;
+    fmi2TerminateTYPE* terminate = nullptr;
+
+    fmi2GetIntegerTYPE* get_integer = nullptr;
+    fmi2GetRealTYPE* get_real = nullptr;
+    fmi2GetStringTYPE* get_string = nullptr;
+    fmi2GetBooleanTYPE* get_boolean = nullptr;
+
+    fmi2SetIntegerTYPE* set_integer = nullptr;
+    fmi2SetRealTYPE* set_real = nullptr;
+    fmi2SetStringTYPE* set_string = nullptr;
+    fmi2SetBooleanTYPE* set_boolean = nullptr;
+
+    fmi2GetFMUstateTYPE* get_fmu_state = nullptr;
+    fmi2SetFMUstateTYPE* set_fmu_state = nullptr;
+    fmi2FreeFMUstateTYPE* free_fmu_state = nullptr;
+
+    fmi2SerializedFMUstateSizeTYPE* serialized_fmu_state_size = nullptr;
+    fmi2SerializeFMUstateTYPE* serialize_fmu_state = nullptr;
+    fmi2DeSerializeFMUstateTYPE* de_serialize_fmu_state = nullptr;
+
+    fmi2GetDirectionalDerivativeTYPE* get_directional_derivative = nullptr;
+
+    fmi2FreeInstanceTYPE* free_instance = nullptr;
+
+    // co-simulation
+    fmi2SetRealInputDerivativesTYPE* set_real_input_derivatives = nullptr;
+    fmi2GetRealOutputDerivativesTYPE* get_real_output_derivatives = nullptr;
+
+    fmi2DoStepTYPE* do_step = nullptr;
+    fmi2CancelStepTYPE* cancel_step = nullptr;
+
+    fmi2GetStatusTYPE* get_status = nullptr;
+    fmi2GetRealStatusTYPE* get_real_status = nullptr;
+    fmi2GetIntegerStatusTYPE* get_integer_status = nullptr;
+    fmi2GetBooleanStatusTYPE* get_boolean_status = nullptr;
+    fmi2GetStringStatusTYPE* get_string_status = nullptr;
+
+    // model exchange
+    fmi2EnterEventModeTYPE* enter_event_mode = nullptr;
+    fmi2EnterContinuousTimeModeTYPE* enter_continuous_time_mode = nullptr;
+    fmi2SetTimeTYPE* set_time = nullptr;
+    fmi2SetContinuousStatesTYPE* set_continuous_states = nullptr;
+    fmi2GetDerivativesTYPE* get_derivatives = nullptr;
+    fmi2GetEventIndicatorsTYPE* get_event_indicators = nullptr;
+    fmi2GetContinuousStatesTYPE* get_continuous_states = nullptr;
+    fmi2GetNominalsOfContinuousStatesTYPE* get_nominals_of_continuous_states = nullptr;
+    fmi2CompletedIntegratorStepTYPE* completed_integrator_step = nullptr;
+    fmi2NewDiscreteStatesTYPE* new_discrete_states = nullptr;
+};
+
+} // namespace fmi4cpp::fmi2
+
+#endif //FMI4CPP_FMI2_FUNCTIONS_HPP
@@ -4,6 +4,7 @@
 
 #include <fmi4cpp/dll_handle.hpp>
 #include <fmi4cpp/fmi2/fmi2FunctionTypes.h>
+#include <fmi4cpp/fmi2/fmi2_functions.hpp>
 #include <fmi4cpp/fmu_resource.hpp>
 
 #include <cstdio>
@@ -14,56 +15,46 @@
 namespace fmi4cpp::fmi2
 {
 
+class cs_slave_handle;
+
 class fmi2_library
 {
 
+    friend class cs_slave_handle;
+
 private:
     std::shared_ptr<fmu_resource> resource_;
 
-    fmi2GetVersionTYPE* fmi2GetVersion_;
-    fmi2GetTypesPlatformTYPE* fmi2GetTypesPlatform_;
-
-    fmi2SetDebugLoggingTYPE* fmi2SetDebugLogging_;
-
-    fmi2InstantiateTYPE* fmi2Instantiate_;
-    fmi2SetupExperimentTYPE* fmi2SetupExperiment_;
-    fmi2EnterInitializationModeTYPE* fmi2EnterInitializationMode_;
-    fmi2ExitInitializationModeTYPE* fmi2ExitInitializationMode_;
-
-    fmi2ResetTYPE* fmi2Reset_;
-    fmi2TerminateTYPE* fmi2Terminate_;
-
-    fmi2GetIntegerTYPE* fmi2GetInteger_;
-    fmi2GetRealTYPE* fmi2GetReal_;
-    fmi2GetStringTYPE* fmi2GetString_;
-    fmi2GetBooleanTYPE* fmi2GetBoolean_;
-
-    fmi2SetIntegerTYPE* fmi2SetInteger_;
-    fmi2SetRealTYPE* fmi2SetReal_;
-    fmi2SetStringTYPE* fmi2SetString_;
-    fmi2SetBooleanTYPE* fmi2SetBoolean_;
-
-    fmi2GetFMUstateTYPE* fmi2GetFMUstate_;
-    fmi2SetFMUstateTYPE* fmi2SetFMUstate_;
-    fmi2FreeFMUstateTYPE* fmi2FreeFMUstate_;
-
-    fmi2SerializedFMUstateSizeTYPE* fmi2SerializedFMUstateSize_;
-    fmi2SerializeFMUstateTYPE* fmi2SerializeFMUstate_;
-    fmi2DeSerializeFMUstateTYPE* fmi2DeSerializeFMUstate_;
-
-    fmi2GetDirectionalDerivativeTYPE* fmi2GetDirectionalDerivative_;
-
-    fmi2FreeInstanceTYPE* fmi2FreeInstance_;
+    // unloads the shared library once the last copy of this library is gone
+    std::shared_ptr<void> sharedHandle_;
 
 protected:
-    fmi2Status lastStatus_;
+    fmi2_functions functions_;
+
+    // on its own cache line, as instances on different threads each update the status of their own copy
+    alignas(64) fmi2Status lastStatus_ = fmi2OK;
     DLL_HANDLE handle_ = nullptr;
     bool update_status_and_return_true_if_ok(fmi2Status status);
 
 public:
     fmi2_library(const std::string& modelIdentifier, const std::shared_ptr<fmu_resource>& resource);
 
+    /**
+     * Copies share the loaded shared library and its functions, but keep their own last status.
+     * Giving each instance its own copy lets instances of one FMU run on separate threads.
+     */
+    fmi2_library(const fmi2_library& other) = default;
+
     [[nodiscard]] DLL_HANDLE handle() const;
+
+    /**
+     * The functions resolved from the shared library, for calling the FMI C API directly.
+     */
+    [[nodiscard]] const fmi2_functions& functions() const
+    {
+        return functions_;
+    }
+
     [[nodiscard]] fmi2Status last_status() const;
     [[nodiscard]] fmi2String get_version() const;
     [[nodiscard]] fmi2String get_types_platform() const;
@@ -83,30 +74,38 @@ public:
 
     bool read_integer(fmi2Component c, fmi2ValueReference vr, fmi2Integer& ref);
     bool read_integer(fmi2Component c, const std::vector<fmi2ValueReference>& vr, std::vector<fmi2Integer>& ref);
+    bool read_integer(fmi2Component c, const fmi2ValueReference* vr, size_t nvr, fmi2Integer* ref);
 
     bool read_real(fmi2Component c, fmi2ValueReference vr, fmi2Real& ref);
     bool read_real(fmi2Component c, const std::vector<fmi2ValueReference>& vr, std::vector<fmi2Real>& ref);
+    bool read_real(fmi2Component c, const fmi2ValueReference* vr, size_t nvr, fmi2Real* ref);
 
     bool read_string(fmi2Component c, fmi2ValueReference vr, fmi2String& ref);
     bool read_string(fmi2Component c, const std::vector<fmi2ValueReference>& vr, std::vector<fmi2String>& ref);
+    bool read_string(fmi2Component c, const fmi2ValueReference* vr, size_t nvr, fmi2String* ref);
 
     bool read_boolean(fmi2Component c, fmi2ValueReference vr, fmi2Boolean& ref);
     bool read_boolean(fmi2Component c, const std::vector<fmi2ValueReference>& vr, std::vector<fmi2Boolean>& ref);
+    bool read_boolean(fmi2Component c, const fmi2ValueReference* vr, size_t nvr, fmi2Boolean* ref);
 
     bool write_integer(fmi2Component c, fmi2ValueReference vr, const fmi2Integer& value);
     bool write_integer(fmi2Component c, const std::vector<fmi2ValueReference>& vr,
         const std::vector<fmi2Integer>& values);
+    bool write_integer(fmi2Component c, const fmi2ValueReference* vr, size_t nvr, const fmi2Integer* values);
 
     bool write_real(fmi2Component c, fmi2ValueReference vr, const fmi2Real& value);
     bool write_real(fmi2Component c, const std::vector<fmi2ValueReference>& vr, const std::vector<fmi2Real>& values);
+    bool write_real(fmi2Component c, const fmi2ValueReference* vr, size_t nvr, const fmi2Real* values);
 
     bool write_string(fmi2Component c, fmi2ValueReference vr, fmi2String& value);
     bool write_string(fmi2Component c, const std::vector<fmi2ValueReference>& vr,
         const std::vector<fmi2String>& values);
+    bool write_string(fmi2Component c, const fmi2ValueReference* vr, size_t nvr, const fmi2String* values);
 
     bool write_boolean(fmi2Component c, fmi2ValueReference vr, const fmi2Boolean& value);
     bool write_boolean(fmi2Component c, const std::vector<fmi2ValueReference>& vr,
         const std::vector<fmi2Boolean>& values);
+    bool write_boolean(fmi2Component c, const fmi2ValueReference* vr, size_t nvr, const fmi2Boolean* values);
 
     bool get_fmu_state(fmi2Component c, fmi2FMUstate& state);
     bool set_fmu_state(fmi2Component c, fmi2FMUstate state);
@@ -122,8 +121,6 @@ public:
         const std::vector<fmi2Real>& dvKnownRef, std::vector<fmi2Real>& dvUnknownRef);
 
     void free_instance(fmi2Component c);
-
-    ~fmi2_library();
 };
 
 } // namespace fmi4cpp::fmi2
@@ -0,0 +1,99 @@
+
+#ifndef FMI4CPP_FMI2_INSTANCEGROUP_HPP
+#define FMI4CPP_FMI2_INSTANCEGROUP_HPP
+
+#include <fmi4cpp/access_plan.hpp>
+#include <fmi4cpp/fmi2/cs_fmu.hpp>
+#include <fmi4cpp/fmi2/cs_slave.hpp>
+#include <fmi4cpp/group_matrix.hpp>
+
+#include <exception>
+#include <memory>
+#include <vector>
+
+namespace fmi4cpp::fmi2
+{
+
+/**
+ * A fleet of co-simulation slaves of one FMU, stepped, read and written together.
+ *
+ * With more than one thread, the members are split into contiguous ranges that are handled by a pool
+ * of worker threads owned by the group, the calling thread taking one of the ranges. Each member has its own
+ * library copy and last status, but the FMU itself must support having its instances called from different threads.
+ */
+class instance_group
+{
+
+private:
+    class worker_pool;
+
+    std::vector<std::unique_ptr<cs_slave>> members_;
+    std::unique_ptr<worker_pool> pool_;
+
+    // per range scratch buffers for the values of one member
+    struct scratch
+    {
+        std::vector<fmi2Integer> integers;
+        std::vector<fmi2Real> reals;
+        std::vector<fmi2Boolean> booleans;
+    };
+    std::vector<scratch> scratch_;
+
+    // per range outcome of the last group operation
+    std::vector<char> rangeOk_;
+    std::vector<std::exception_ptr> rangeErrors_;
+
+    // calls fn(range, begin, end) for every range, defined in the source file where it is used
+    template<typename Fn>
+    bool for_each_range(Fn&& fn);
+
+public:
+    /**
+     * Instantiates size slaves of fmu, using up to threads threads for group operations.
+     */
+    instance_group(cs_fmu& fmu, size_t size, size_t threads = 1);
+    ~instance_group();
+
+    [[nodiscard]] size_t size() const
+    {
+        return members_.size();
+    }
+
+    [[nodiscard]] cs_slave& operator[](size_t i)
+    {
+        return *members_[i];
+    }
+
+    /**
+     * Matrix with a row for every value reference of plan, so plan.slot(signal).index is the row of a signal.
+     */
+    [[nodiscard]] group_matrix make_matrix(const access_plan& plan) const
+    {
+        return group_matrix(plan.value_references(), members_.size());
+    }
+
+    bool setup_experiment(double start = 0, double stop = 0, double tolerance = 0);
+    bool enter_initialization_mode();
+    bool exit_initialization_mode();
+
+    /**
+     * Steps every member, returning whether all steps succeeded.
+     */
+    bool step_all(double stepSize);
+
+    /**
+     * Gathers the values of the layout of matrix from every member, with one call per base type and member.
+     */
+    bool read_all(group_matrix& matrix);
+
+    /**
+     * Scatters the values of matrix to every member, with one call per base type and member.
+     */
+    bool write_all(const group_matrix& matrix);
+
+    bool terminate();
+};
+
+} // namespace fmi4cpp::fmi2
+
+#endif //FMI4CPP_FMI2_INSTANCEGROUP_HPP
@@ -10,18 +10,6 @@ namespace fmi4cpp::fmi2
 class me_library : public fmi2_library
 {
 
-private:
-    fmi2EnterEventModeTYPE* fmi2EnterEventMode_;
-    fmi2EnterContinuousTimeModeTYPE* fmi2EnterContinuousTimeMode_;
-    fmi2SetTimeTYPE* fmi2SetTime_;
-    fmi2SetContinuousStatesTYPE* fmi2SetContinuousStates_;
-    fmi2GetDerivativesTYPE* fmi2GetDerivatives_;
-    fmi2GetEventIndicatorsTYPE* fmi2GetEventIndicators_;
-    fmi2GetContinuousStatesTYPE* fmi2GetContinuousStates_;
-    fmi2GetNominalsOfContinuousStatesTYPE* fmi2GetNominalsOfContinuousStates_;
-    fmi2CompletedIntegratorStepTYPE* fmi2CompletedIntegratorStep_;
-    fmi2NewDiscreteStatesTYPE* fmi2NewDiscreteStates_;
-
 public:
     explicit me_library(
         const std::string& modelIdentifier,
@@ -3,6 +3,7 @@
 #define FMI4CPP_ENUMS_HPP
 
 #include <string>
+#include <string_view>
 
 namespace fmi4cpp::fmi2
 {
@@ -36,9 +37,9 @@ enum class initial
     unknown
 };
 
-causality parse_causality(const std::string& str);
-variability parse_variability(const std::string& str);
-initial parse_initial(const std::string& str);
+causality parse_causality(std::string_view str);
+variability parse_variability(std::string_view str);
+initial parse_initial(std::string_view str);
 
 std::string to_string(causality causality);
 std::string to_string(variability variability);
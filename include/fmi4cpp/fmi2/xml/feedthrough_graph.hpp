@@ -0,0 +1,58 @@
+
+#ifndef FMI4CPP_FEEDTHROUGHGRAPH_HPP
+#define FMI4CPP_FEEDTHROUGHGRAPH_HPP
+
+#include <fmi4cpp/fmi2/xml/model_structure.hpp>
+#include <fmi4cpp/fmi2/xml/model_variables.hpp>
+#include <fmi4cpp/types.hpp>
+
+#include <vector>
+
+namespace fmi4cpp::fmi2
+{
+
+/**
+ * Direct feedthrough from inputs to outputs, as a compressed adjacency list.
+ * Output o depends directly on the inputs input_indices[output_offsets[o]] ... input_indices[output_offsets[o + 1] - 1].
+ *
+ * An output without a dependencies attribute is listed as depending on every input and has full_dependency set,
+ * while one with an empty list depends on no input.
+ */
+struct feedthrough_graph
+{
+    // value references and 0-based ModelVariables indices of inputs and outputs, in ModelVariables/ModelStructure order
+    std::vector<fmi4cppValueReference> input_vrs;
+    std::vector<size_t> input_variables;
+    std::vector<fmi4cppValueReference> output_vrs;
+    std::vector<size_t> output_variables;
+
+    std::vector<size_t> output_offsets;
+    std::vector<size_t> input_indices;
+    std::vector<bool> full_dependency;
+
+    [[nodiscard]] size_t num_inputs() const
+    {
+        return input_vrs.size();
+    }
+
+    [[nodiscard]] size_t num_outputs() const
+    {
+        return output_vrs.size();
+    }
+
+    /**
+     * Whether output depends directly on any input.
+     */
+    [[nodiscard]] bool has_feedthrough(size_t output) const
+    {
+        return output_offsets[output + 1] > output_offsets[output];
+    }
+
+    [[nodiscard]] bool depends_on(size_t output, size_t input) const;
+};
+
+feedthrough_graph make_feedthrough_graph(const model_variables& variables, const model_structure& structure);
+
+} // namespace fmi4cpp::fmi2
+
+#endif //FMI4CPP_FEEDTHROUGHGRAPH_HPP
@@ -0,0 +1,71 @@
+
+#ifndef FMI4CPP_JACOBIANSPARSITY_HPP
+#define FMI4CPP_JACOBIANSPARSITY_HPP
+
+#include <fmi4cpp/fmi2/xml/model_structure.hpp>
+#include <fmi4cpp/fmi2/xml/model_variables.hpp>
+#include <fmi4cpp/types.hpp>
+
+#include <vector>
+
+namespace fmi4cpp::fmi2
+{
+
+/**
+ * Sparsity pattern of the Jacobian of the state derivatives and Real outputs with respect to
+ * the continuous states and Real inputs, in compressed row storage.
+ * Rows are the derivatives followed by the outputs, columns the states followed by the inputs,
+ * each in ModelStructure/ModelVariables order.
+ *
+ * Columns are coloured so that no two columns of the same colour share a row. Seeding all columns
+ * of one colour at once yields their entries without overlap, so the full Jacobian takes
+ * num_colours directional derivatives or finite-difference perturbations.
+ */
+struct jacobian_sparsity
+{
+    std::vector<fmi4cppValueReference> row_vrs;
+    std::vector<fmi4cppValueReference> column_vrs;
+
+    // entries of row r are column_indices[row_offsets[r]] ... column_indices[row_offsets[r + 1] - 1]
+    std::vector<size_t> row_offsets;
+    std::vector<size_t> column_indices;
+
+    std::vector<size_t> colours;
+    size_t num_colours = 0;
+
+    [[nodiscard]] size_t rows() const
+    {
+        return row_vrs.size();
+    }
+
+    [[nodiscard]] size_t columns() const
+    {
+        return column_vrs.size();
+    }
+
+    [[nodiscard]] size_t non_zeros() const
+    {
+        return column_indices.size();
+    }
+
+    /**
+     * Value references of the columns with the given colour, i.e. the knowns to seed together.
+     */
+    [[nodiscard]] std::vector<fmi4cppValueReference> seed(size_t colour) const;
+
+    /**
+     * Stores the entries recovered from one colour into values, which is laid out like column_indices.
+     * derivatives holds the directional derivative of every row for the seed of that colour.
+     */
+    void scatter(size_t colour, const std::vector<fmi4cppReal>& derivatives, std::vector<fmi4cppReal>& values) const;
+};
+
+/**
+ * Builds the sparsity pattern from the dependencies in structure. An unknown without a dependencies
+ * attribute depends on all columns, one with an empty list on none.
+ */
+jacobian_sparsity make_jacobian_sparsity(const model_variables& variables, const model_structure& structure);
+
+} // namespace fmi4cpp::fmi2
+
+#endif //FMI4CPP_JACOBIANSPARSITY_HPP
@@ -2,10 +2,15 @@
 #ifndef FMI4CPP_MODELDESCRIPTION_HPP
 #define FMI4CPP_MODELDESCRIPTION_HPP
 
+#include <fmi4cpp/access_plan.hpp>
 #include <fmi4cpp/fmi2/xml/default_experiment.hpp>
+#include <fmi4cpp/fmi2/xml/feedthrough_graph.hpp>
 #include <fmi4cpp/fmi2/xml/fmu_attributes.hpp>
+#include <fmi4cpp/fmi2/xml/jacobian_sparsity.hpp>
 #include <fmi4cpp/fmi2/xml/model_structure.hpp>
 #include <fmi4cpp/fmi2/xml/model_variables.hpp>
+#include <fmi4cpp/fmi2/xml/type_definitions.hpp>
+#include <fmi4cpp/fmi2/xml/unit_definitions.hpp>
 
 #include <memory>
 #include <optional>
@@ -32,6 +37,10 @@ struct model_description_base
     std::shared_ptr<const fmi2::model_variables> model_variables;
     std::shared_ptr<const fmi2::model_structure> model_structure;
 
+    // never null, empty when the model description has no UnitDefinitions/TypeDefinitions
+    std::shared_ptr<const fmi2::unit_definitions> unit_definitions = std::make_shared<const fmi2::unit_definitions>();
+    std::shared_ptr<const fmi2::type_definitions> type_definitions = std::make_shared<const fmi2::type_definitions>();
+
     std::optional<fmi2::default_experiment> default_experiment;
 
     size_t number_of_event_indicators;
@@ -39,6 +48,48 @@ struct model_description_base
 
     [[nodiscard]] unsigned int get_value_reference(const std::string& name) const;
     [[nodiscard]] const scalar_variable& get_variable_by_name(const std::string& name) const;
+
+    /**
+     * Value reference of the named variable, which must be of the given base type.
+     */
+    [[nodiscard]] unsigned int get_value_reference(const std::string& name, base_type type) const;
+
+    template<base_type Type>
+    [[nodiscard]] variable_ref<Type> get_variable_ref(const std::string& name) const
+    {
+        return {get_value_reference(name, Type)};
+    }
+
+    template<base_type Type>
+    [[nodiscard]] variable_refs<Type> get_variable_refs(const std::vector<std::string>& names) const
+    {
+        variable_refs<Type> refs;
+        refs.vrs.reserve(names.size());
+        for (const auto& name : names) {
+            refs.vrs.push_back(get_value_reference(name, Type));
+        }
+        return refs;
+    }
+
+    [[nodiscard]] value_reference_set select_by_prefix(const std::string& prefix) const;
+    [[nodiscard]] value_reference_set select_by_glob(const std::string& pattern) const;
+    [[nodiscard]] value_reference_set select_by_array_index(const std::string& arrayName, size_t first, size_t last) const;
+
+    /**
+     * Access plan for the named variables, with signal i being names[i].
+     */
+    [[nodiscard]] access_plan make_access_plan(const std::vector<std::string>& names) const;
+
+    /**
+     * Sparsity pattern and column colouring of the Jacobian of derivatives and outputs
+     * with respect to states and inputs, see jacobian_sparsity.
+     */
+    [[nodiscard]] jacobian_sparsity get_jacobian_sparsity() const;
+
+    /**
+     * Direct feedthrough from inputs to outputs, see feedthrough_graph.
+     */
+    [[nodiscard]] feedthrough_graph get_feedthrough_graph() const;
 };
 
 struct cs_model_description;
@@ -51,6 +102,10 @@ protected:
     std::optional<cs_attributes> coSimulation_;
     std::optional<me_attributes> modelExchange_;
 
+    // built once and shared by every as_cs_description()/as_me_description() caller
+    std::shared_ptr<const cs_model_description> csDescription_;
+    std::shared_ptr<const me_model_description> meDescription_;
+
 public:
     model_description(
         const model_description_base& base,
@@ -60,8 +115,8 @@ public:
     [[nodiscard]] bool supports_cs() const;
     [[nodiscard]] bool supports_me() const;
 
-    [[nodiscard]] std::unique_ptr<const cs_model_description> as_cs_description() const;
-    [[nodiscard]] std::unique_ptr<const me_model_description> as_me_description() const;
+    [[nodiscard]] std::shared_ptr<const cs_model_description> as_cs_description() const;
+    [[nodiscard]] std::shared_ptr<const me_model_description> as_me_description() const;
 };
 
 } // namespace fmi4cpp::fmi2
@@ -12,6 +12,13 @@ namespace fmi4cpp::fmi2
 
 std::unique_ptr<const model_description> parse_model_description(const std::string& fileName);
 
+/**
+ * Parses the model description in a single forward pass over the file, without building a DOM.
+ * Peak memory stays close to the size of the resulting model description, which matters for
+ * FMUs with very large numbers of variables. The result is identical to parse_model_description.
+ */
+std::unique_ptr<const model_description> parse_model_description_streaming(const std::string& fileName);
+
 }
 
 #endif //FMI4CPP_MODELDESCRIPTIONPARSER_HPP
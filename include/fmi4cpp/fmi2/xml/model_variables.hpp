@@ -2,8 +2,12 @@
 #ifndef FMI4CPP_MODELVARIABLES_HPP
 #define FMI4CPP_MODELVARIABLES_HPP
 
+#include <fmi4cpp/fmi2/xml/model_structure.hpp>
 #include <fmi4cpp/fmi2/xml/scalar_variable.hpp>
+#include <fmi4cpp/parameter_set.hpp>
+#include <fmi4cpp/value_reference_set.hpp>
 
+#include <array>
 #include <memory>
 #include <string>
 #include <vector>
@@ -11,16 +15,75 @@
 namespace fmi4cpp::fmi2
 {
 
+/**
+ * A subset of the model variables, computed once when the model variables are created.
+ * Holds the variable indices in declaration order, and the same variables' value references split by base type.
+ */
+struct variable_partition
+{
+    std::vector<size_t> indices;
+    value_reference_set value_references;
+};
+
+/**
+ * Value references for reading a selection of variables, with aliases collapsed into a single entry.
+ * The value read for value_references.reals[i] belongs to the selected variables at the positions
+ * listed in real_targets[i], and likewise for the other base types.
+ */
+struct alias_read_set
+{
+    value_reference_set value_references;
+    std::vector<std::vector<size_t>> integer_targets;
+    std::vector<std::vector<size_t>> real_targets;
+    std::vector<std::vector<size_t>> boolean_targets;
+    std::vector<std::vector<size_t>> string_targets;
+};
+
+/**
+ * Hands each value read through an alias_read_set to all of its targets, calling fun(position, value).
+ */
+template<typename T, typename function>
+void fan_out(const std::vector<T>& values, const std::vector<std::vector<size_t>>& targets, function&& fun)
+{
+    for (size_t i = 0; i < targets.size(); i++) {
+        for (const auto position : targets[i]) {
+            fun(position, values[i]);
+        }
+    }
+}
+
 class model_variables
 {
 
 private:
     const std::vector<scalar_variable> variables_ = {};
 
+    // variable indices ordered by name, used for name, prefix and glob lookups
+    std::vector<size_t> nameOrder_;
+
+    std::array<variable_partition, static_cast<size_t>(causality::unknown) + 1> causalities_;
+    std::array<variable_partition, static_cast<size_t>(variability::unknown) + 1> variabilities_;
+    variable_partition states_;
+    variable_partition derivatives_;
+
+    // variable indices ordered by value reference, used for value reference lookups
+    std::vector<size_t> vrOrder_;
+    // variables sharing base type and value reference, and the alias group of each variable
+    std::vector<std::vector<size_t>> aliasGroups_;
+    std::vector<size_t> aliasGroupOf_;
+
+    parameter_set startValues_;
+
+    [[nodiscard]] std::pair<size_t, size_t> prefix_range(const std::string& prefix) const;
+    [[nodiscard]] std::vector<size_t>::const_iterator vr_lower_bound(fmi2ValueReference vr) const;
+
 public:
     model_variables();
 
-    explicit model_variables(std::vector<scalar_variable>  variables);
+    /**
+     * derivatives are the Unknowns listed under ModelStructure/Derivatives, which define the continuous states.
+     */
+    explicit model_variables(std::vector<scalar_variable> variables, const std::vector<unknown>& derivatives = {});
 
     [[nodiscard]] size_t size() const;
 
@@ -31,6 +94,66 @@ public:
     void getByValueReference(fmi2ValueReference vr, std::vector<scalar_variable>& store) const;
     void getByCausality(causality causality, std::vector<scalar_variable>& store) const;
 
+    /**
+     * Indices of all variables whose name starts with prefix, in declaration order.
+     */
+    [[nodiscard]] std::vector<size_t> find_by_prefix(const std::string& prefix) const;
+
+    /**
+     * Indices of all variables whose name matches pattern, in declaration order.
+     * '*' matches any sequence of characters and '?' matches a single character.
+     * Everything else, including '[' and ']', is matched literally.
+     */
+    [[nodiscard]] std::vector<size_t> find_by_glob(const std::string& pattern) const;
+
+    /**
+     * Indices of all variables located under arrayName[i], with first <= i <= last, in declaration order.
+     * For multi-dimensional arrays the range applies to the first dimension.
+     */
+    [[nodiscard]] std::vector<size_t> find_by_array_index(const std::string& arrayName, size_t first, size_t last) const;
+
+    [[nodiscard]] value_reference_set value_references(const std::vector<size_t>& indices) const;
+
+    /**
+     * Indices of all variables that share base type and value reference with the variable at index,
+     * including the variable itself, in declaration order. Integer and Enumeration count as the same base type.
+     */
+    [[nodiscard]] const std::vector<size_t>& aliases(size_t index) const;
+
+    /**
+     * Read set for the variables at the given indices, where aliases are only read once.
+     * Target positions refer to the position in indices.
+     */
+    [[nodiscard]] alias_read_set read_set(const std::vector<size_t>& indices) const;
+
+    /**
+     * Start values of all variables that may be set before initialization, one entry per alias group.
+     * Constants, the independent variable, calculated parameters and variables with initial="calculated" are left out.
+     */
+    [[nodiscard]] const parameter_set& start_values() const;
+
+    /**
+     * All variables with the given causality. Unlike getByCausality, nothing is scanned or copied.
+     */
+    [[nodiscard]] const variable_partition& by_causality(causality causality) const;
+
+    /**
+     * All variables with the given variability, e.g. continuous or discrete.
+     */
+    [[nodiscard]] const variable_partition& by_variability(variability variability) const;
+
+    /**
+     * Continuous states, i.e. the variables whose derivatives are listed in ModelStructure/Derivatives.
+     * Ordered so that states().indices[i] is the state of derivatives().indices[i].
+     */
+    [[nodiscard]] const variable_partition& states() const;
+
+    /**
+     * State derivatives, in the order of ModelStructure/Derivatives. Derivatives of inputs and higher order
+     * derivatives that are not listed there are left out.
+     */
+    [[nodiscard]] const variable_partition& derivatives() const;
+
     [[nodiscard]] std::vector<scalar_variable>::const_iterator begin() const;
     [[nodiscard]] std::vector<scalar_variable>::const_iterator end() const;
 };
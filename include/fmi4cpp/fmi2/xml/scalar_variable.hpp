@@ -4,8 +4,12 @@
 
 #include <fmi4cpp/fmi2/fmi2Functions.h>
 #include <fmi4cpp/fmi2/xml/enums.hpp>
+#include <fmi4cpp/fmi2/xml/type_definitions.hpp>
+#include <fmi4cpp/fmi2/xml/unit_definitions.hpp>
 
+#include <memory>
 #include <optional>
+#include <string>
 
 namespace fmi4cpp::fmi2
 {
@@ -34,6 +38,10 @@ struct scalar_variable_base
 
     fmi2ValueReference value_reference;
     bool can_handle_multiple_set_per_time_instant;
+
+    // the tables of the model description, which the unit and type ids of the attributes refer to
+    std::shared_ptr<const fmi2::unit_definitions> unit_definitions;
+    std::shared_ptr<const fmi2::type_definitions> type_definitions;
 };
 
 
@@ -41,7 +49,8 @@ template<typename T>
 struct scalar_variable_attribute
 {
     std::optional<T> start;
-    std::optional<std::string> declared_type;
+    // position of the declared type in the model's type_definitions
+    std::optional<unsigned int> declared_type_id;
 };
 
 
@@ -71,8 +80,10 @@ struct real_attribute : bounded_scalar_variable_attribute<double>
     std::optional<double> nominal;
     std::optional<unsigned int> derivative;
 
-    std::optional<std::string> unit;
-    std::optional<std::string> display_unit;
+    // unit, or the unit of the declared type, in the model's unit_definitions
+    std::optional<unsigned int> unit_id;
+    // display unit within the display units of unit_id
+    std::optional<unsigned int> display_unit_id;
 
     explicit real_attribute(const bounded_scalar_variable_attribute<double>& attributes);
 };
@@ -0,0 +1,67 @@
+
+#ifndef FMI4CPP_TYPEDEFINITIONS_HPP
+#define FMI4CPP_TYPEDEFINITIONS_HPP
+
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace fmi4cpp::fmi2
+{
+
+struct enumeration_item
+{
+    std::string name;
+    int value = 0;
+    std::optional<std::string> description;
+};
+
+/**
+ * A SimpleType of the TypeDefinitions. Which of the attributes apply depends on type_name,
+ * being one of "Real", "Integer", "Boolean", "String" or "Enumeration".
+ */
+struct simple_type
+{
+    std::string name;
+    std::optional<std::string> description;
+    std::string type_name;
+
+    std::optional<std::string> quantity;
+    std::optional<std::string> unit;
+    std::optional<std::string> display_unit;
+    std::optional<unsigned int> unit_id;
+    std::optional<unsigned int> display_unit_id;
+
+    std::optional<double> min;
+    std::optional<double> max;
+    std::optional<double> nominal;
+    bool relative_quantity = false;
+    bool unbounded = false;
+
+    std::vector<enumeration_item> items;
+};
+
+/**
+ * The TypeDefinitions of a model description. Types are referred to by their position in the table.
+ */
+class type_definitions
+{
+
+private:
+    std::vector<simple_type> types_;
+    std::unordered_map<std::string, unsigned int> ids_;
+
+public:
+    type_definitions() = default;
+    explicit type_definitions(std::vector<simple_type> types);
+
+    [[nodiscard]] size_t size() const;
+    const simple_type& operator[](unsigned int id) const;
+
+    [[nodiscard]] std::optional<unsigned int> find(const std::string& name) const;
+};
+
+} // namespace fmi4cpp::fmi2
+
+#endif //FMI4CPP_TYPEDEFINITIONS_HPP
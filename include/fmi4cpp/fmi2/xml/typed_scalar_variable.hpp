@@ -21,6 +21,11 @@ protected:
 private:
     const scalar_variable variable_;
 
+protected:
+    [[nodiscard]] const scalar_variable& variable() const
+    {
+        return variable_;
+    }
 
 public:
     typed_scalar_variable(
@@ -70,9 +75,20 @@ public:
         return attribute_.start;
     }
 
+    /**
+     * Name of the declared type, looked up in the type definitions of the model.
+     */
     [[nodiscard]] std::optional<std::string> declaredType() const
     {
-        return attribute_.declaredType;
+        if (!attribute_.declared_type_id || !variable_.type_definitions) {
+            return std::nullopt;
+        }
+        return (*variable_.type_definitions)[*attribute_.declared_type_id].name;
+    }
+
+    [[nodiscard]] std::optional<unsigned int> declaredTypeId() const
+    {
+        return attribute_.declared_type_id;
     }
 
     [[nodiscard]] const U& attribute() const
@@ -141,8 +157,14 @@ public:
 
     [[nodiscard]] std::optional<double> nominal() const;
     [[nodiscard]] std::optional<unsigned int> derivative() const;
+    /**
+     * Names of the unit and display unit, looked up in the unit definitions of the model.
+     * The unit falls back to the one of the declared type.
+     */
     [[nodiscard]] std::optional<std::string> unit() const;
     [[nodiscard]] std::optional<std::string> displayUnit() const;
+    [[nodiscard]] std::optional<unsigned int> unitId() const;
+    [[nodiscard]] std::optional<unsigned int> displayUnitId() const;
 };
 
 
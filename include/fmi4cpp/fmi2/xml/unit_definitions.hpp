@@ -0,0 +1,121 @@
+
+#ifndef FMI4CPP_UNITDEFINITIONS_HPP
+#define FMI4CPP_UNITDEFINITIONS_HPP
+
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace fmi4cpp::fmi2
+{
+
+/**
+ * Linear conversion y = factor * x + offset between two units.
+ */
+struct unit_conversion
+{
+    double factor = 1.0;
+    double offset = 0.0;
+
+    [[nodiscard]] double apply(double value) const
+    {
+        return factor * value + offset;
+    }
+
+    /**
+     * Converts n values at once, in and out may point to the same buffer.
+     */
+    void apply(const double* in, double* out, size_t n) const
+    {
+        for (size_t i = 0; i < n; i++) {
+            out[i] = factor * in[i] + offset;
+        }
+    }
+
+    [[nodiscard]] unit_conversion inverse() const
+    {
+        return {1.0 / factor, -offset / factor};
+    }
+};
+
+struct base_unit
+{
+    int kg = 0;
+    int m = 0;
+    int s = 0;
+    int A = 0;
+    int K = 0;
+    int mol = 0;
+    int cd = 0;
+    int rad = 0;
+    double factor = 1.0;
+    double offset = 0.0;
+
+    [[nodiscard]] bool same_dimension(const base_unit& other) const
+    {
+        return kg == other.kg && m == other.m && s == other.s && A == other.A &&
+            K == other.K && mol == other.mol && cd == other.cd && rad == other.rad;
+    }
+};
+
+struct display_unit
+{
+    std::string name;
+    double factor = 1.0;
+    double offset = 0.0;
+};
+
+struct unit
+{
+    std::string name;
+    std::optional<fmi2::base_unit> base_unit;
+    std::vector<fmi2::display_unit> display_units;
+};
+
+/**
+ * The UnitDefinitions of a model description, followed by the units used but not defined there.
+ * Units are referred to by their position in the table.
+ */
+class unit_definitions
+{
+
+private:
+    std::vector<unit> units_;
+    std::unordered_map<std::string, unsigned int> ids_;
+
+public:
+    unit_definitions() = default;
+    explicit unit_definitions(std::vector<unit> units);
+
+    [[nodiscard]] size_t size() const;
+    const unit& operator[](unsigned int id) const;
+
+    [[nodiscard]] std::optional<unsigned int> find(const std::string& name) const;
+
+    /**
+     * Id of the named unit, which is added without a base unit if the UnitDefinitions do not define it,
+     * so that variables refer to every unit by id. Used while parsing.
+     */
+    unsigned int find_or_add(const std::string& name);
+    [[nodiscard]] std::optional<unsigned int> find_display_unit(unsigned int unitId, const std::string& name) const;
+
+    /**
+     * Conversion from values in the unit to its display unit.
+     */
+    [[nodiscard]] unit_conversion to_display_unit(unsigned int unitId, unsigned int displayUnitId) const;
+
+    /**
+     * Conversion from values in the unit to its SI base unit.
+     */
+    [[nodiscard]] unit_conversion to_base_unit(unsigned int unitId) const;
+
+    /**
+     * Conversion between two units of the same dimension, or nothing if either has no base unit or the dimensions differ.
+     */
+    [[nodiscard]] std::optional<unit_conversion> conversion(unsigned int fromUnitId, unsigned int toUnitId) const;
+};
+
+} // namespace fmi4cpp::fmi2
+
+#endif //FMI4CPP_UNITDEFINITIONS_HPP
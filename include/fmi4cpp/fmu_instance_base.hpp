@@ -2,12 +2,19 @@
 #ifndef FMI4CPP_ABSTRACTFMUINSTANCE_HPP
 #define FMI4CPP_ABSTRACTFMUINSTANCE_HPP
 
+#include <fmi4cpp/access_plan.hpp>
+#include <fmi4cpp/conversions.hpp>
 #include <fmi4cpp/fmu_instance.hpp>
 #include <fmi4cpp/fmu_resource.hpp>
+#include <fmi4cpp/parameter_set.hpp>
+#include <fmi4cpp/string_arena.hpp>
+#include <fmi4cpp/typed_access.hpp>
 #include <fmi4cpp/types.hpp>
+#include <fmi4cpp/value_frame.hpp>
 
 #include <memory>
 #include <string>
+#include <string_view>
 
 namespace fmi4cpp
 {
@@ -21,6 +28,13 @@ private:
     bool instanceFreed_ = false;
     std::shared_ptr<fmu_resource> resource_;
 
+    // pointers to string values passed to and from the FMU by read_frame and write_frame
+    std::vector<fmi4cppString> stringBuffer_;
+    string_arena stringArena_;
+
+    // Boolean and Integer values converted to and from user types by read_boolean_bits and the like
+    std::vector<fmi4cppInteger> discreteBuffer_;
+
 protected:
     fmi4cppComponent c_;
     const std::shared_ptr<fmi_library> library_;
@@ -37,6 +51,19 @@ public:
         , modelDescription_(modelDescription)
     {}
 
+    [[nodiscard]] fmi4cppComponent component() const
+    {
+        return c_;
+    }
+
+    /**
+     * The functions of the FMI C API resolved for this instance, to be called with component().
+     */
+    [[nodiscard]] const auto& functions() const
+    {
+        return library_->functions();
+    }
+
     std::shared_ptr<const model_description> get_model_description() const override
     {
         return modelDescription_;
@@ -156,6 +183,14 @@ public:
         return library_->read_integer(c_, vr, ref);
     }
 
+    bool read_integer(
+        const fmi4cppValueReference* vr,
+        size_t nvr,
+        fmi4cppInteger* ref) override
+    {
+        return library_->read_integer(c_, vr, nvr, ref);
+    }
+
     bool read_real(
         const fmi4cppValueReference vr,
         fmi4cppReal& ref) override
@@ -170,6 +205,14 @@ public:
         return library_->read_real(c_, vr, ref);
     }
 
+    bool read_real(
+        const fmi4cppValueReference* vr,
+        size_t nvr,
+        fmi4cppReal* ref) override
+    {
+        return library_->read_real(c_, vr, nvr, ref);
+    }
+
     bool read_string(
         const fmi4cppValueReference vr,
         fmi4cppString& ref) override
@@ -184,6 +227,14 @@ public:
         return library_->read_string(c_, vr, ref);
     }
 
+    bool read_string(
+        const fmi4cppValueReference* vr,
+        size_t nvr,
+        fmi4cppString* ref) override
+    {
+        return library_->read_string(c_, vr, nvr, ref);
+    }
+
     bool read_boolean(
         const fmi4cppValueReference vr,
         fmi4cppBoolean& ref) override
@@ -198,6 +249,14 @@ public:
         return library_->read_boolean(c_, vr, ref);
     }
 
+    bool read_boolean(
+        const fmi4cppValueReference* vr,
+        size_t nvr,
+        fmi4cppBoolean* ref) override
+    {
+        return library_->read_boolean(c_, vr, nvr, ref);
+    }
+
     bool write_integer(
         const fmi4cppValueReference vr,
         const fmi4cppInteger value) override
@@ -212,6 +271,14 @@ public:
         return library_->write_integer(c_, vr, values);
     }
 
+    bool write_integer(
+        const fmi4cppValueReference* vr,
+        size_t nvr,
+        const fmi4cppInteger* values) override
+    {
+        return library_->write_integer(c_, vr, nvr, values);
+    }
+
     bool write_real(
         const fmi4cppValueReference vr,
         const fmi4cppReal value) override
@@ -226,6 +293,14 @@ public:
         return library_->write_real(c_, vr, values);
     }
 
+    bool write_real(
+        const fmi4cppValueReference* vr,
+        size_t nvr,
+        const fmi4cppReal* values) override
+    {
+        return library_->write_real(c_, vr, nvr, values);
+    }
+
     bool write_string(
         const fmi4cppValueReference vr,
         fmi4cppString value) override
@@ -240,6 +315,14 @@ public:
         return library_->write_string(c_, vr, values);
     }
 
+    bool write_string(
+        const fmi4cppValueReference* vr,
+        size_t nvr,
+        const fmi4cppString* values) override
+    {
+        return library_->write_string(c_, vr, nvr, values);
+    }
+
     bool write_boolean(
         const fmi4cppValueReference vr,
         const fmi4cppBoolean value) override
@@ -254,6 +337,311 @@ public:
         return library_->write_boolean(c_, vr, values);
     }
 
+    bool write_boolean(
+        const fmi4cppValueReference* vr,
+        size_t nvr,
+        const fmi4cppBoolean* values) override
+    {
+        return library_->write_boolean(c_, vr, nvr, values);
+    }
+
+    /**
+     * Reads all signals of plan into its value buffers, with one call per base type.
+     * Goes through the read functions, so any caching or write buffering of the instance applies.
+     */
+    bool read(access_plan& plan)
+    {
+        const auto& vrs = plan.value_references();
+        if (!vrs.integers.empty() &&
+            !this->read_integer(vrs.integers.data(), vrs.integers.size(), plan.values<base_type::integer>().data())) {
+            return false;
+        }
+        if (!vrs.reals.empty() &&
+            !this->read_real(vrs.reals.data(), vrs.reals.size(), plan.values<base_type::real>().data())) {
+            return false;
+        }
+        if (!vrs.booleans.empty() &&
+            !this->read_boolean(vrs.booleans.data(), vrs.booleans.size(), plan.values<base_type::boolean>().data())) {
+            return false;
+        }
+        if (!vrs.strings.empty() &&
+            !this->read_string(vrs.strings.data(), vrs.strings.size(), plan.values<base_type::string>().data())) {
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * Writes the value buffers of plan, with one call per base type, through the write functions.
+     */
+    bool write(const access_plan& plan)
+    {
+        const auto& vrs = plan.value_references();
+        if (!vrs.integers.empty() &&
+            !this->write_integer(vrs.integers.data(), vrs.integers.size(), plan.values<base_type::integer>().data())) {
+            return false;
+        }
+        if (!vrs.reals.empty() &&
+            !this->write_real(vrs.reals.data(), vrs.reals.size(), plan.values<base_type::real>().data())) {
+            return false;
+        }
+        if (!vrs.booleans.empty() &&
+            !this->write_boolean(vrs.booleans.data(), vrs.booleans.size(), plan.values<base_type::boolean>().data())) {
+            return false;
+        }
+        if (!vrs.strings.empty() &&
+            !this->write_string(vrs.strings.data(), vrs.strings.size(), plan.values<base_type::string>().data())) {
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * Reads the values of all value references in the layout of frame, with one call per base type,
+     * through the read functions.
+     */
+    bool read_frame(value_frame& frame)
+    {
+        const auto& vrs = frame.layout();
+        if (!vrs.integers.empty() &&
+            !this->read_integer(vrs.integers.data(), vrs.integers.size(), frame.integers().data())) {
+            return false;
+        }
+        if (!vrs.reals.empty() &&
+            !this->read_real(vrs.reals.data(), vrs.reals.size(), frame.reals().data())) {
+            return false;
+        }
+        if (!vrs.booleans.empty() &&
+            !this->read_boolean(vrs.booleans.data(), vrs.booleans.size(), frame.booleans().data())) {
+            return false;
+        }
+        if (!vrs.strings.empty()) {
+            stringBuffer_.resize(vrs.strings.size());
+            if (!this->read_string(vrs.strings.data(), vrs.strings.size(), stringBuffer_.data())) {
+                return false;
+            }
+            auto& strings = frame.strings();
+            for (size_t i = 0; i < stringBuffer_.size(); i++) {
+                strings[i].assign(stringBuffer_[i] ? stringBuffer_[i] : "");
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Reads the variables behind typed handles, through the read function of their base type.
+     */
+    template<base_type Type>
+    bool get(const fmi4cppValueReference* vr, size_t nvr, typename base_type_traits<Type>::value_type* ref)
+    {
+        if constexpr (Type == base_type::integer) {
+            return this->read_integer(vr, nvr, ref);
+        } else if constexpr (Type == base_type::real) {
+            return this->read_real(vr, nvr, ref);
+        } else if constexpr (Type == base_type::boolean) {
+            return this->read_boolean(vr, nvr, ref);
+        } else {
+            return this->read_string(vr, nvr, ref);
+        }
+    }
+
+    template<base_type Type>
+    bool get(variable_ref<Type> v, typename base_type_traits<Type>::value_type& ref)
+    {
+        return get<Type>(&v.vr, 1, &ref);
+    }
+
+    template<base_type Type>
+    bool get(const variable_refs<Type>& refs, typename base_type_traits<Type>::value_type* values)
+    {
+        return get<Type>(refs.vrs.data(), refs.vrs.size(), values);
+    }
+
+    /**
+     * Writes the variables behind typed handles, through the write function of their base type.
+     */
+    template<base_type Type>
+    bool set(const fmi4cppValueReference* vr, size_t nvr, const typename base_type_traits<Type>::value_type* values)
+    {
+        if constexpr (Type == base_type::integer) {
+            return this->write_integer(vr, nvr, values);
+        } else if constexpr (Type == base_type::real) {
+            return this->write_real(vr, nvr, values);
+        } else if constexpr (Type == base_type::boolean) {
+            return this->write_boolean(vr, nvr, values);
+        } else {
+            return this->write_string(vr, nvr, values);
+        }
+    }
+
+    template<base_type Type>
+    bool set(variable_ref<Type> v, typename base_type_traits<Type>::value_type value)
+    {
+        return set<Type>(&v.vr, 1, &value);
+    }
+
+    template<base_type Type>
+    bool set(const variable_refs<Type>& refs, const typename base_type_traits<Type>::value_type* values)
+    {
+        return set<Type>(refs.vrs.data(), refs.vrs.size(), values);
+    }
+
+    /**
+     * Reads a string value into the string arena of the instance, see string_arena for how long ref stays valid.
+     */
+    bool read_string_view(fmi4cppValueReference vr, std::string_view& ref)
+    {
+        return read_string_view(&vr, 1, &ref);
+    }
+
+    bool read_string_view(const fmi4cppValueReference* vr, size_t nvr, std::string_view* ref)
+    {
+        stringBuffer_.resize(nvr);
+        if (!this->read_string(vr, nvr, stringBuffer_.data())) {
+            return false;
+        }
+        for (size_t i = 0; i < nvr; i++) {
+            ref[i] = stringArena_.store(vr[i], stringBuffer_[i]);
+        }
+        return true;
+    }
+
+    bool read_string_view(const std::vector<fmi4cppValueReference>& vr, std::vector<std::string_view>& ref)
+    {
+        ref.resize(vr.size());
+        return read_string_view(vr.data(), vr.size(), ref.data());
+    }
+
+    /**
+     * Reads Boolean values packed into bits, see booleans_to_bits.
+     */
+    bool read_boolean_bits(const fmi4cppValueReference* vr, size_t nvr, uint64_t* bits)
+    {
+        discreteBuffer_.resize(nvr);
+        if (!this->read_boolean(vr, nvr, discreteBuffer_.data())) {
+            return false;
+        }
+        booleans_to_bits(discreteBuffer_.data(), nvr, bits);
+        return true;
+    }
+
+    bool write_boolean_bits(const fmi4cppValueReference* vr, size_t nvr, const uint64_t* bits)
+    {
+        discreteBuffer_.resize(nvr);
+        bits_to_booleans(bits, nvr, discreteBuffer_.data());
+        return this->write_boolean(vr, nvr, discreteBuffer_.data());
+    }
+
+    /**
+     * Reads Boolean values into a bool or uint8_t array.
+     */
+    template<typename Byte>
+    bool read_boolean_bytes(const fmi4cppValueReference* vr, size_t nvr, Byte* bytes)
+    {
+        discreteBuffer_.resize(nvr);
+        if (!this->read_boolean(vr, nvr, discreteBuffer_.data())) {
+            return false;
+        }
+        booleans_to_bytes(discreteBuffer_.data(), nvr, bytes);
+        return true;
+    }
+
+    template<typename Byte>
+    bool write_boolean_bytes(const fmi4cppValueReference* vr, size_t nvr, const Byte* bytes)
+    {
+        discreteBuffer_.resize(nvr);
+        bytes_to_booleans(bytes, nvr, discreteBuffer_.data());
+        return this->write_boolean(vr, nvr, discreteBuffer_.data());
+    }
+
+    /**
+     * Reads Integer values into an int16_t or int8_t array, saturating values out of its range.
+     */
+    template<typename Narrow>
+    bool read_integer_narrowed(const fmi4cppValueReference* vr, size_t nvr, Narrow* values)
+    {
+        discreteBuffer_.resize(nvr);
+        if (!this->read_integer(vr, nvr, discreteBuffer_.data())) {
+            return false;
+        }
+        narrow_integers(discreteBuffer_.data(), nvr, values);
+        return true;
+    }
+
+    template<typename Narrow>
+    bool write_integer_narrowed(const fmi4cppValueReference* vr, size_t nvr, const Narrow* values)
+    {
+        discreteBuffer_.resize(nvr);
+        widen_integers(values, nvr, discreteBuffer_.data());
+        return this->write_integer(vr, nvr, discreteBuffer_.data());
+    }
+
+    /**
+     * Writes the values of frame, with one call per base type, through the write functions.
+     */
+    bool write_frame(const value_frame& frame)
+    {
+        const auto& vrs = frame.layout();
+        if (!vrs.integers.empty() &&
+            !this->write_integer(vrs.integers.data(), vrs.integers.size(), frame.integers().data())) {
+            return false;
+        }
+        if (!vrs.reals.empty() &&
+            !this->write_real(vrs.reals.data(), vrs.reals.size(), frame.reals().data())) {
+            return false;
+        }
+        if (!vrs.booleans.empty() &&
+            !this->write_boolean(vrs.booleans.data(), vrs.booleans.size(), frame.booleans().data())) {
+            return false;
+        }
+        if (!vrs.strings.empty()) {
+            const auto& strings = frame.strings();
+            stringBuffer_.resize(strings.size());
+            for (size_t i = 0; i < strings.size(); i++) {
+                stringBuffer_[i] = strings[i].c_str();
+            }
+            if (!this->write_string(vrs.strings.data(), vrs.strings.size(), stringBuffer_.data())) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Writes the start values of the model description, with one vectorized call per base type.
+     */
+    bool apply_start_values()
+    {
+        return apply_parameter_set(modelDescription_->model_variables->start_values());
+    }
+
+    /**
+     * Writes all values in set, with one vectorized call per base type.
+     */
+    bool apply_parameter_set(const parameter_set& set)
+    {
+        if (!set.integer_vrs.empty() && !this->write_integer(set.integer_vrs, set.integer_values)) {
+            return false;
+        }
+        if (!set.real_vrs.empty() && !this->write_real(set.real_vrs, set.real_values)) {
+            return false;
+        }
+        if (!set.boolean_vrs.empty() && !this->write_boolean(set.boolean_vrs, set.boolean_values)) {
+            return false;
+        }
+        if (!set.string_vrs.empty()) {
+            std::vector<fmi4cppString> values;
+            values.reserve(set.string_values.size());
+            for (const auto& value : set.string_values) {
+                values.push_back(value.c_str());
+            }
+            if (!this->write_string(set.string_vrs, values)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     ~fmu_instance_base()
     {
         terminate();
@@ -4,28 +4,40 @@
 
 #include <fmi4cpp/types.hpp>
 
+#include <cstddef>
 #include <vector>
 
 namespace fmi4cpp
 {
 
+/**
+ * The overloads taking a pointer and a count read into caller owned memory holding at least nvr values,
+ * so any contiguous buffer can be used without copying or allocating.
+ */
 class fmu_reader
 {
 
 public:
     virtual bool read_integer(fmi4cppValueReference vr, fmi4cppInteger& ref) = 0;
     virtual bool read_integer(const std::vector<fmi4cppValueReference>& vr, std::vector<fmi4cppInteger>& ref) = 0;
+    virtual bool read_integer(const fmi4cppValueReference* vr, size_t nvr, fmi4cppInteger* ref) = 0;
 
     virtual bool read_real(fmi4cppValueReference vr, fmi4cppReal& ref) = 0;
     virtual bool read_real(const std::vector<fmi4cppValueReference>& vr, std::vector<fmi4cppReal>& ref) = 0;
+    virtual bool read_real(const fmi4cppValueReference* vr, size_t nvr, fmi4cppReal* ref) = 0;
 
     virtual bool read_string(fmi4cppValueReference vr, fmi4cppString& ref) = 0;
     virtual bool read_string(const std::vector<fmi4cppValueReference>& vr, std::vector<fmi4cppString>& ref) = 0;
+    virtual bool read_string(const fmi4cppValueReference* vr, size_t nvr, fmi4cppString* ref) = 0;
 
     virtual bool read_boolean(fmi4cppValueReference vr, fmi4cppBoolean& ref) = 0;
     virtual bool read_boolean(const std::vector<fmi4cppValueReference>& vr, std::vector<fmi4cppBoolean>& ref) = 0;
+    virtual bool read_boolean(const fmi4cppValueReference* vr, size_t nvr, fmi4cppBoolean* ref) = 0;
 };
 
+/**
+ * The overloads taking a pointer and a count write nvr values straight from caller owned memory.
+ */
 class fmu_writer
 {
 
@@ -34,21 +46,25 @@ public:
     virtual bool write_integer(
         const std::vector<fmi4cppValueReference>& vr,
         const std::vector<fmi4cppInteger>& values) = 0;
+    virtual bool write_integer(const fmi4cppValueReference* vr, size_t nvr, const fmi4cppInteger* values) = 0;
 
     virtual bool write_real(fmi4cppValueReference vr, fmi4cppReal value) = 0;
     virtual bool write_real(
         const std::vector<fmi4cppValueReference>& vr,
         const std::vector<fmi4cppReal>& values) = 0;
+    virtual bool write_real(const fmi4cppValueReference* vr, size_t nvr, const fmi4cppReal* values) = 0;
 
     virtual bool write_string(fmi4cppValueReference vr, fmi4cppString value) = 0;
     virtual bool write_string(
         const std::vector<fmi4cppValueReference>& vr,
         const std::vector<fmi4cppString>& values) = 0;
+    virtual bool write_string(const fmi4cppValueReference* vr, size_t nvr, const fmi4cppString* values) = 0;
 
     virtual bool write_boolean(fmi4cppValueReference vr, fmi4cppBoolean value) = 0;
     virtual bool write_boolean(
         const std::vector<fmi4cppValueReference>& vr,
         const std::vector<fmi4cppBoolean>& values) = 0;
+    virtual bool write_boolean(const fmi4cppValueReference* vr, size_t nvr, const fmi4cppBoolean* values) = 0;
 };
 
 class fmu_variable_accessor : public fmu_reader, public fmu_writer
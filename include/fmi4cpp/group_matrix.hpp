@@ -0,0 +1,89 @@
+
+#ifndef FMI4CPP_GROUPMATRIX_HPP
+#define FMI4CPP_GROUPMATRIX_HPP
+
+#include <fmi4cpp/typed_access.hpp>
+#include <fmi4cpp/types.hpp>
+#include <fmi4cpp/value_reference_set.hpp>
+
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace fmi4cpp
+{
+
+/**
+ * Values of a fixed set of value references across a group of instances, stored as one row per value reference
+ * holding the value of every instance, so that row<Type>(i)[k] is the value of the i'th value reference
+ * of that type, e.g. layout().reals[i], in instance k. Operations on a signal across the whole group
+ * thus run over contiguous memory.
+ *
+ * Integer, Real and Boolean values are supported.
+ */
+class group_matrix
+{
+
+private:
+    value_reference_set layout_;
+    size_t instances_;
+
+    std::vector<fmi4cppInteger> integers_;
+    std::vector<fmi4cppReal> reals_;
+    std::vector<fmi4cppBoolean> booleans_;
+
+    template<base_type Type>
+    std::vector<typename base_type_traits<Type>::value_type>& values()
+    {
+        static_assert(Type != base_type::string, "Strings are not supported");
+        if constexpr (Type == base_type::integer) {
+            return integers_;
+        } else if constexpr (Type == base_type::real) {
+            return reals_;
+        } else {
+            return booleans_;
+        }
+    }
+
+public:
+    group_matrix(value_reference_set layout, size_t instances)
+        : layout_(std::move(layout))
+        , instances_(instances)
+        , integers_(layout_.integers.size() * instances)
+        , reals_(layout_.reals.size() * instances)
+        , booleans_(layout_.booleans.size() * instances)
+    {
+        if (!layout_.strings.empty()) {
+            throw std::runtime_error("A group_matrix cannot hold String values");
+        }
+    }
+
+    [[nodiscard]] const value_reference_set& layout() const
+    {
+        return layout_;
+    }
+
+    [[nodiscard]] size_t instances() const
+    {
+        return instances_;
+    }
+
+    /**
+     * The values of the index'th value reference of a base type, one per instance.
+     */
+    template<base_type Type>
+    [[nodiscard]] typename base_type_traits<Type>::value_type* row(size_t index)
+    {
+        return values<Type>().data() + index * instances_;
+    }
+
+    template<base_type Type>
+    [[nodiscard]] const typename base_type_traits<Type>::value_type* row(size_t index) const
+    {
+        return const_cast<group_matrix*>(this)->row<Type>(index);
+    }
+};
+
+} // namespace fmi4cpp
+
+#endif //FMI4CPP_GROUPMATRIX_HPP
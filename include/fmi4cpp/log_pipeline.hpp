@@ -0,0 +1,122 @@
+
+#ifndef FMI4CPP_LOGPIPELINE_HPP
+#define FMI4CPP_LOGPIPELINE_HPP
+
+#include <fmi4cpp/status.hpp>
+#include <fmi4cpp/types.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdarg>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace fmi4cpp
+{
+
+/**
+ * A message logged by an FMU. The views are only valid during the call to the sink.
+ */
+struct log_record
+{
+    std::chrono::system_clock::time_point time;
+    std::string_view instance_name;
+    fmi4cpp::status status;
+    std::string_view category;
+    std::string_view message;
+    // the message was cut to fit in log_pipeline::max_message_length
+    bool truncated;
+};
+
+using log_sink = std::function<void(const log_record&)>;
+
+/**
+ * Passes the messages logged by FMUs on to sinks from a background thread.
+ *
+ * Logging only formats the message into a slot of a fixed size ring buffer, which any number of threads
+ * can claim without locking, so FMUs that log a lot are not held up by I/O. When the buffer is full,
+ * messages are dropped and counted rather than waited for.
+ * The background thread sleeps until a message is pushed, rather than polling.
+ * By default, messages at or above FMI4CPP_LOG_LEVEL are written to standard output, or standard error
+ * for errors. Other sinks are passed every message.
+ */
+class log_pipeline
+{
+
+public:
+    static constexpr size_t capacity = 1024;
+    static constexpr size_t max_message_length = 1024;
+    static constexpr size_t max_name_length = 128;
+
+    /**
+     * The pipeline of the process, which the FMU logger callback writes to.
+     */
+    static log_pipeline& instance();
+
+    /**
+     * Writes a record to standard output or error, the default sink. OK maps to the Info level,
+     * Warning, Discard and Pending to Warn.
+     */
+    static void console_sink(const log_record& record);
+
+    log_pipeline();
+    ~log_pipeline();
+
+    log_pipeline(const log_pipeline&) = delete;
+    log_pipeline& operator=(const log_pipeline&) = delete;
+
+    /**
+     * Formats a message, printf style, and queues it, or drops it if the buffer is full.
+     */
+    void push(fmi4cppString instanceName, fmi4cpp::status status, fmi4cppString category,
+        fmi4cppString format, va_list args);
+
+    void set_sinks(std::vector<log_sink> sinks);
+    void add_sink(log_sink sink);
+
+    /**
+     * Waits until every message queued before the call has been passed to the sinks.
+     */
+    void flush();
+
+    /**
+     * Number of messages dropped because the buffer was full.
+     */
+    [[nodiscard]] uint64_t dropped() const
+    {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct slot;
+
+    std::unique_ptr<slot[]> slots_;
+    // on separate cache lines, as producers contend for the first and the consumer owns the second
+    alignas(64) std::atomic<uint64_t> enqueuePos_{0};
+    alignas(64) std::atomic<uint64_t> dequeuePos_{0};
+    alignas(64) std::atomic<uint64_t> dropped_{0};
+
+    std::mutex sinksMutex_;
+    std::vector<log_sink> sinks_;
+
+    std::mutex wakeMutex_;
+    std::condition_variable wake_;
+    std::condition_variable drained_;
+    std::atomic<bool> sleeping_{false};
+    bool stopping_ = false;
+    std::thread consumer_;
+
+    bool ready() const;
+    bool drain();
+    void run();
+};
+
+} // namespace fmi4cpp
+
+#endif //FMI4CPP_LOGPIPELINE_HPP
@@ -0,0 +1,69 @@
+
+#ifndef FMI4CPP_PARAMETERSET_HPP
+#define FMI4CPP_PARAMETERSET_HPP
+
+#include <fmi4cpp/types.hpp>
+
+#include <string>
+#include <vector>
+
+namespace fmi4cpp
+{
+
+/**
+ * Values to write to an instance, stored contiguously per base type
+ * so that each type can be applied with a single vectorized call.
+ * Enumerations are written as integers and end up in the integer arrays.
+ */
+struct parameter_set
+{
+    std::vector<fmi4cppValueReference> integer_vrs;
+    std::vector<fmi4cppInteger> integer_values;
+
+    std::vector<fmi4cppValueReference> real_vrs;
+    std::vector<fmi4cppReal> real_values;
+
+    std::vector<fmi4cppValueReference> boolean_vrs;
+    std::vector<fmi4cppBoolean> boolean_values;
+
+    std::vector<fmi4cppValueReference> string_vrs;
+    std::vector<std::string> string_values;
+
+    void add_integer(fmi4cppValueReference vr, fmi4cppInteger value)
+    {
+        integer_vrs.push_back(vr);
+        integer_values.push_back(value);
+    }
+
+    void add_real(fmi4cppValueReference vr, fmi4cppReal value)
+    {
+        real_vrs.push_back(vr);
+        real_values.push_back(value);
+    }
+
+    void add_boolean(fmi4cppValueReference vr, fmi4cppBoolean value)
+    {
+        boolean_vrs.push_back(vr);
+        boolean_values.push_back(value);
+    }
+
+    void add_string(fmi4cppValueReference vr, std::string value)
+    {
+        string_vrs.push_back(vr);
+        string_values.push_back(std::move(value));
+    }
+
+    [[nodiscard]] size_t size() const
+    {
+        return integer_vrs.size() + real_vrs.size() + boolean_vrs.size() + string_vrs.size();
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+        return size() == 0;
+    }
+};
+
+} // namespace fmi4cpp
+
+#endif //FMI4CPP_PARAMETERSET_HPP
@@ -0,0 +1,68 @@
+
+#ifndef FMI4CPP_STRINGARENA_HPP
+#define FMI4CPP_STRINGARENA_HPP
+
+#include <fmi4cpp/types.hpp>
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace fmi4cpp
+{
+
+/**
+ * Copies of the string values read from an instance, one per value reference.
+ *
+ * Storing the value of a value reference again reuses its buffer, so once the buffers have grown to fit,
+ * reading strings does not allocate. A value equal to the stored one is not copied, and views
+ * of it stay valid. A view is invalidated when a different value is stored for its value reference,
+ * typically on the next read after a step, or when the arena is cleared.
+ */
+class string_arena
+{
+
+private:
+    // nodes are never moved, so views into the strings stay valid while other value references are added
+    std::unordered_map<fmi4cppValueReference, std::string> values_;
+
+public:
+    std::string_view store(fmi4cppValueReference vr, fmi4cppString value)
+    {
+        auto& stored = values_[vr];
+        const std::string_view view = value ? value : "";
+        if (stored != view) {
+            stored.assign(view);
+        }
+        return stored;
+    }
+
+    /**
+     * The value last stored for vr, or an empty view if there is none.
+     */
+    [[nodiscard]] std::string_view get(fmi4cppValueReference vr) const
+    {
+        const auto it = values_.find(vr);
+        if (it == values_.end()) {
+            return {};
+        }
+        return it->second;
+    }
+
+    [[nodiscard]] size_t size() const
+    {
+        return values_.size();
+    }
+
+    /**
+     * Releases the stored values, invalidating all views.
+     */
+    void clear()
+    {
+        values_.clear();
+    }
+};
+
+} // namespace fmi4cpp
+
+#endif //FMI4CPP_STRINGARENA_HPP
@@ -0,0 +1,201 @@
+
+#ifndef FMI4CPP_TYPEDACCESS_HPP
+#define FMI4CPP_TYPEDACCESS_HPP
+
+#include <fmi4cpp/fmu_variable_accessor.hpp>
+#include <fmi4cpp/types.hpp>
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace fmi4cpp
+{
+
+enum class base_type
+{
+    integer,
+    real,
+    boolean,
+    string
+};
+
+template<base_type Type>
+struct base_type_traits;
+
+template<>
+struct base_type_traits<base_type::integer>
+{
+    using value_type = fmi4cppInteger;
+};
+
+template<>
+struct base_type_traits<base_type::real>
+{
+    using value_type = fmi4cppReal;
+};
+
+template<>
+struct base_type_traits<base_type::boolean>
+{
+    using value_type = fmi4cppBoolean;
+};
+
+template<>
+struct base_type_traits<base_type::string>
+{
+    using value_type = fmi4cppString;
+};
+
+/**
+ * A value reference that carries its base type, so the matching read/write function is selected at compile time.
+ */
+template<base_type Type>
+struct typed_value_reference
+{
+    using value_type = typename base_type_traits<Type>::value_type;
+    static constexpr base_type type = Type;
+
+    fmi4cppValueReference vr;
+};
+
+using integer_vr = typed_value_reference<base_type::integer>;
+using real_vr = typed_value_reference<base_type::real>;
+using boolean_vr = typed_value_reference<base_type::boolean>;
+using string_vr = typed_value_reference<base_type::string>;
+
+/**
+ * Handle to a variable of a given base type, e.g. variable_ref<base_type::real>,
+ * obtained by name from the model description.
+ */
+template<base_type Type>
+using variable_ref = typed_value_reference<Type>;
+
+/**
+ * Handles to several variables of the same base type, read or written with one call.
+ */
+template<base_type Type>
+struct variable_refs
+{
+    using value_type = typename base_type_traits<Type>::value_type;
+    static constexpr base_type type = Type;
+
+    std::vector<fmi4cppValueReference> vrs;
+
+    [[nodiscard]] size_t size() const
+    {
+        return vrs.size();
+    }
+
+    [[nodiscard]] variable_ref<Type> operator[](size_t i) const
+    {
+        return {vrs[i]};
+    }
+};
+
+template<base_type Type>
+bool read(fmu_reader& reader, typed_value_reference<Type> v, typename base_type_traits<Type>::value_type& ref)
+{
+    if constexpr (Type == base_type::integer) {
+        return reader.read_integer(v.vr, ref);
+    } else if constexpr (Type == base_type::real) {
+        return reader.read_real(v.vr, ref);
+    } else if constexpr (Type == base_type::boolean) {
+        return reader.read_boolean(v.vr, ref);
+    } else {
+        return reader.read_string(v.vr, ref);
+    }
+}
+
+template<base_type Type>
+bool write(fmu_writer& writer, typed_value_reference<Type> v, typename base_type_traits<Type>::value_type value)
+{
+    if constexpr (Type == base_type::integer) {
+        return writer.write_integer(v.vr, value);
+    } else if constexpr (Type == base_type::real) {
+        return writer.write_real(v.vr, value);
+    } else if constexpr (Type == base_type::boolean) {
+        return writer.write_boolean(v.vr, value);
+    } else {
+        return writer.write_string(v.vr, value);
+    }
+}
+
+/**
+ * Reads the values of vrs into ref, which is resized to match.
+ */
+template<base_type Type>
+bool read(
+    fmu_reader& reader,
+    const std::vector<fmi4cppValueReference>& vrs,
+    std::vector<typename base_type_traits<Type>::value_type>& ref)
+{
+    ref.resize(vrs.size());
+    if constexpr (Type == base_type::integer) {
+        return reader.read_integer(vrs, ref);
+    } else if constexpr (Type == base_type::real) {
+        return reader.read_real(vrs, ref);
+    } else if constexpr (Type == base_type::boolean) {
+        return reader.read_boolean(vrs, ref);
+    } else {
+        return reader.read_string(vrs, ref);
+    }
+}
+
+template<base_type Type>
+bool write(
+    fmu_writer& writer,
+    const std::vector<fmi4cppValueReference>& vrs,
+    const std::vector<typename base_type_traits<Type>::value_type>& values)
+{
+    if constexpr (Type == base_type::integer) {
+        return writer.write_integer(vrs, values);
+    } else if constexpr (Type == base_type::real) {
+        return writer.write_real(vrs, values);
+    } else if constexpr (Type == base_type::boolean) {
+        return writer.write_boolean(vrs, values);
+    } else {
+        return writer.write_string(vrs, values);
+    }
+}
+
+/**
+ * Reads a fixed number of values, such as a group of generated bindings, without allocating.
+ */
+template<base_type Type, size_t N>
+bool read(
+    fmu_reader& reader,
+    const std::array<fmi4cppValueReference, N>& vrs,
+    std::array<typename base_type_traits<Type>::value_type, N>& ref)
+{
+    if constexpr (Type == base_type::integer) {
+        return reader.read_integer(vrs.data(), N, ref.data());
+    } else if constexpr (Type == base_type::real) {
+        return reader.read_real(vrs.data(), N, ref.data());
+    } else if constexpr (Type == base_type::boolean) {
+        return reader.read_boolean(vrs.data(), N, ref.data());
+    } else {
+        return reader.read_string(vrs.data(), N, ref.data());
+    }
+}
+
+template<base_type Type, size_t N>
+bool write(
+    fmu_writer& writer,
+    const std::array<fmi4cppValueReference, N>& vrs,
+    const std::array<typename base_type_traits<Type>::value_type, N>& values)
+{
+    if constexpr (Type == base_type::integer) {
+        return writer.write_integer(vrs.data(), N, values.data());
+    } else if constexpr (Type == base_type::real) {
+        return writer.write_real(vrs.data(), N, values.data());
+    } else if constexpr (Type == base_type::boolean) {
+        return writer.write_boolean(vrs.data(), N, values.data());
+    } else {
+        return writer.write_string(vrs.data(), N, values.data());
+    }
+}
+
+} // namespace fmi4cpp
+
+#endif //FMI4CPP_TYPEDACCESS_HPP
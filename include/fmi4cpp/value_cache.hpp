@@ -0,0 +1,180 @@
+
+#ifndef FMI4CPP_VALUECACHE_HPP
+#define FMI4CPP_VALUECACHE_HPP
+
+#include <fmi4cpp/typed_access.hpp>
+#include <fmi4cpp/types.hpp>
+#include <fmi4cpp/value_reference_set.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace fmi4cpp
+{
+
+/**
+ * Values read from an instance since its values last changed, so that repeated reads of the same
+ * value reference are served from memory. Integer, Real and Boolean values are cached, strings are not,
+ * as the FMU owns the memory of the strings it returns.
+ *
+ * Each base type maps its value references to consecutive slots through a sorted index, built from the
+ * value references of the model description, so that sparse or very large value references cost no more
+ * than small ones. Each slot is tagged with the epoch it was read in, and invalidate() starts a new epoch,
+ * which drops every entry at once. Value references missing from the model description get a slot on first put.
+ */
+class value_cache
+{
+
+private:
+    template<typename T>
+    struct table
+    {
+        std::vector<fmi4cppValueReference> vrs; // sorted, slot i holds the value of vrs[i]
+        std::vector<T> values;
+        std::vector<uint64_t> epochs;
+        std::vector<T> scratch;
+
+        void index(std::vector<fmi4cppValueReference> known)
+        {
+            std::sort(known.begin(), known.end());
+            known.erase(std::unique(known.begin(), known.end()), known.end());
+            vrs = std::move(known);
+            values.assign(vrs.size(), T());
+            epochs.assign(vrs.size(), 0);
+        }
+
+        [[nodiscard]] const T* find(fmi4cppValueReference vr, uint64_t epoch) const
+        {
+            const auto it = std::lower_bound(vrs.begin(), vrs.end(), vr);
+            if (it == vrs.end() || *it != vr) {
+                return nullptr;
+            }
+            const auto slot = static_cast<size_t>(it - vrs.begin());
+            return epochs[slot] == epoch ? &values[slot] : nullptr;
+        }
+
+        size_t slot_of(fmi4cppValueReference vr)
+        {
+            const auto it = std::lower_bound(vrs.begin(), vrs.end(), vr);
+            const auto slot = static_cast<size_t>(it - vrs.begin());
+            if (it == vrs.end() || *it != vr) {
+                vrs.insert(it, vr);
+                values.insert(values.begin() + slot, T());
+                epochs.insert(epochs.begin() + slot, 0);
+            }
+            return slot;
+        }
+    };
+
+    uint64_t epoch_ = 1;
+    value_reference_set eager_;
+
+    table<fmi4cppInteger> integers_;
+    table<fmi4cppReal> reals_;
+    table<fmi4cppBoolean> booleans_;
+
+    template<base_type Type>
+    auto& table_of()
+    {
+        static_assert(Type != base_type::string, "Strings are not cached");
+        if constexpr (Type == base_type::integer) {
+            return integers_;
+        } else if constexpr (Type == base_type::real) {
+            return reals_;
+        } else {
+            return booleans_;
+        }
+    }
+
+    template<base_type Type>
+    const auto& table_of() const
+    {
+        return const_cast<value_cache*>(this)->table_of<Type>();
+    }
+
+public:
+    /**
+     * known holds the value references of the model description, which get their slots up front.
+     * eager holds the value references to read right after every step, rather than on first access.
+     */
+    explicit value_cache(const value_reference_set& known = {}, value_reference_set eager = {})
+        : eager_(std::move(eager))
+    {
+        integers_.index(known.integers);
+        reals_.index(known.reals);
+        booleans_.index(known.booleans);
+        integers_.scratch.resize(eager_.integers.size());
+        reals_.scratch.resize(eager_.reals.size());
+        booleans_.scratch.resize(eager_.booleans.size());
+    }
+
+    [[nodiscard]] const value_reference_set& eager() const
+    {
+        return eager_;
+    }
+
+    /**
+     * Buffer with room for the eagerly read values of a base type.
+     */
+    template<base_type Type>
+    std::vector<typename base_type_traits<Type>::value_type>& scratch()
+    {
+        return table_of<Type>().scratch;
+    }
+
+    void invalidate()
+    {
+        epoch_++;
+    }
+
+    template<base_type Type>
+    bool get(fmi4cppValueReference vr, typename base_type_traits<Type>::value_type& ref) const
+    {
+        if (const auto* value = table_of<Type>().find(vr, epoch_)) {
+            ref = *value;
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * Fills ref with the cached values of all nvr value references, or leaves it untouched unless all are cached.
+     */
+    template<base_type Type>
+    bool get(const fmi4cppValueReference* vr, size_t nvr, typename base_type_traits<Type>::value_type* ref) const
+    {
+        const auto& t = table_of<Type>();
+        for (size_t i = 0; i < nvr; i++) {
+            if (t.find(vr[i], epoch_) == nullptr) {
+                return false;
+            }
+        }
+        for (size_t i = 0; i < nvr; i++) {
+            ref[i] = *t.find(vr[i], epoch_);
+        }
+        return true;
+    }
+
+    template<base_type Type>
+    void put(fmi4cppValueReference vr, typename base_type_traits<Type>::value_type value)
+    {
+        auto& t = table_of<Type>();
+        const auto slot = t.slot_of(vr);
+        t.values[slot] = value;
+        t.epochs[slot] = epoch_;
+    }
+
+    template<base_type Type>
+    void put(const fmi4cppValueReference* vr, size_t nvr, const typename base_type_traits<Type>::value_type* values)
+    {
+        for (size_t i = 0; i < nvr; i++) {
+            put<Type>(vr[i], values[i]);
+        }
+    }
+};
+
+} // namespace fmi4cpp
+
+#endif //FMI4CPP_VALUECACHE_HPP
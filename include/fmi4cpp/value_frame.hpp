@@ -0,0 +1,115 @@
+
+#ifndef FMI4CPP_VALUEFRAME_HPP
+#define FMI4CPP_VALUEFRAME_HPP
+
+#include <fmi4cpp/types.hpp>
+#include <fmi4cpp/value_reference_set.hpp>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace fmi4cpp
+{
+
+/**
+ * Values of a fixed set of value references, kept in one contiguous array per base type,
+ * where integers()[i] is the value of layout().integers[i] and likewise for the other types.
+ *
+ * Copies of a frame share its layout, so copying a frame only copies the values,
+ * and assigning between frames of the same layout does not allocate, strings aside. Strings are
+ * stored by value, so a frame stays valid after the instance it was read from moves on,
+ * and can be handed to another thread, e.g. a recorder.
+ */
+class value_frame
+{
+
+private:
+    std::shared_ptr<const value_reference_set> layout_;
+
+    std::vector<fmi4cppInteger> integers_;
+    std::vector<fmi4cppReal> reals_;
+    std::vector<fmi4cppBoolean> booleans_;
+    std::vector<std::string> strings_;
+
+public:
+    explicit value_frame(std::shared_ptr<const value_reference_set> layout)
+        : layout_(std::move(layout))
+        , integers_(layout_->integers.size())
+        , reals_(layout_->reals.size())
+        , booleans_(layout_->booleans.size())
+        , strings_(layout_->strings.size())
+    {}
+
+    explicit value_frame(value_reference_set layout)
+        : value_frame(std::make_shared<const value_reference_set>(std::move(layout)))
+    {}
+
+    [[nodiscard]] const value_reference_set& layout() const
+    {
+        return *layout_;
+    }
+
+    [[nodiscard]] const std::shared_ptr<const value_reference_set>& shared_layout() const
+    {
+        return layout_;
+    }
+
+    /**
+     * Whether other holds values for the very same layout, rather than an equal one.
+     */
+    [[nodiscard]] bool same_layout(const value_frame& other) const
+    {
+        return layout_ == other.layout_;
+    }
+
+    [[nodiscard]] std::vector<fmi4cppInteger>& integers()
+    {
+        return integers_;
+    }
+
+    [[nodiscard]] const std::vector<fmi4cppInteger>& integers() const
+    {
+        return integers_;
+    }
+
+    [[nodiscard]] std::vector<fmi4cppReal>& reals()
+    {
+        return reals_;
+    }
+
+    [[nodiscard]] const std::vector<fmi4cppReal>& reals() const
+    {
+        return reals_;
+    }
+
+    [[nodiscard]] std::vector<fmi4cppBoolean>& booleans()
+    {
+        return booleans_;
+    }
+
+    [[nodiscard]] const std::vector<fmi4cppBoolean>& booleans() const
+    {
+        return booleans_;
+    }
+
+    [[nodiscard]] std::vector<std::string>& strings()
+    {
+        return strings_;
+    }
+
+    [[nodiscard]] const std::vector<std::string>& strings() const
+    {
+        return strings_;
+    }
+
+    [[nodiscard]] size_t size() const
+    {
+        return layout_->size();
+    }
+};
+
+} // namespace fmi4cpp
+
+#endif //FMI4CPP_VALUEFRAME_HPP
@@ -0,0 +1,37 @@
+
+#ifndef FMI4CPP_VALUEREFERENCESET_HPP
+#define FMI4CPP_VALUEREFERENCESET_HPP
+
+#include <fmi4cpp/types.hpp>
+
+#include <vector>
+
+namespace fmi4cpp
+{
+
+/**
+ * Value references grouped by the base type used to access them,
+ * ready to be passed to the vector versions of read_* and write_*.
+ * Enumerations are accessed as integers and end up in `integers`.
+ */
+struct value_reference_set
+{
+    std::vector<fmi4cppValueReference> integers;
+    std::vector<fmi4cppValueReference> reals;
+    std::vector<fmi4cppValueReference> booleans;
+    std::vector<fmi4cppValueReference> strings;
+
+    [[nodiscard]] size_t size() const
+    {
+        return integers.size() + reals.size() + booleans.size() + strings.size();
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+        return size() == 0;
+    }
+};
+
+} // namespace fmi4cpp
+
+#endif //FMI4CPP_VALUEREFERENCESET_HPP
@@ -0,0 +1,160 @@
+
+#ifndef FMI4CPP_WRITEBUFFER_HPP
+#define FMI4CPP_WRITEBUFFER_HPP
+
+#include <fmi4cpp/types.hpp>
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace fmi4cpp
+{
+
+/**
+ * Writes held back so that they reach the FMU as one call per base type.
+ *
+ * Writing a value reference again replaces its pending value, so only the last write is passed on.
+ * Strings are copied, so the caller's strings need not outlive the write.
+ * The storage is kept after a flush, so writing the same value references step after step does not allocate.
+ */
+class write_buffer
+{
+
+private:
+    template<typename T>
+    struct pending
+    {
+        static constexpr size_t none = SIZE_MAX;
+
+        // slot of each value reference written so far, and the position of its pending write, or none
+        std::unordered_map<fmi4cppValueReference, size_t> slotOf;
+        std::vector<size_t> positions;
+
+        // the first count entries are the pending writes, the ones after are kept for reuse
+        std::vector<fmi4cppValueReference> vrs;
+        std::vector<T> values;
+        std::vector<size_t> slots;
+        size_t count = 0;
+
+        void add(fmi4cppValueReference vr, const T& value)
+        {
+            const auto [it, inserted] = slotOf.try_emplace(vr, positions.size());
+            if (inserted) {
+                positions.push_back(none);
+            }
+            auto& position = positions[it->second];
+            if (position != none) {
+                values[position] = value;
+                return;
+            }
+            position = count;
+            if (count == vrs.size()) {
+                vrs.push_back(vr);
+                values.push_back(value);
+                slots.push_back(it->second);
+            } else {
+                vrs[count] = vr;
+                values[count] = value;
+                slots[count] = it->second;
+            }
+            count++;
+        }
+
+        void clear()
+        {
+            for (size_t i = 0; i < count; i++) {
+                positions[slots[i]] = none;
+            }
+            count = 0;
+        }
+    };
+
+    pending<fmi4cppInteger> integers_;
+    pending<fmi4cppReal> reals_;
+    pending<fmi4cppBoolean> booleans_;
+    pending<std::string> strings_;
+
+    // pointers into strings_.values passed on by flush
+    std::vector<fmi4cppString> stringPointers_;
+
+public:
+    void write_integer(fmi4cppValueReference vr, fmi4cppInteger value)
+    {
+        integers_.add(vr, value);
+    }
+
+    void write_real(fmi4cppValueReference vr, fmi4cppReal value)
+    {
+        reals_.add(vr, value);
+    }
+
+    void write_boolean(fmi4cppValueReference vr, fmi4cppBoolean value)
+    {
+        booleans_.add(vr, value);
+    }
+
+    void write_string(fmi4cppValueReference vr, fmi4cppString value)
+    {
+        strings_.add(vr, value ? value : "");
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+        return size() == 0;
+    }
+
+    /**
+     * Number of pending value references, over all base types.
+     */
+    [[nodiscard]] size_t size() const
+    {
+        return integers_.count + reals_.count + booleans_.count + strings_.count;
+    }
+
+    /**
+     * Drops the pending writes.
+     */
+    void clear()
+    {
+        integers_.clear();
+        reals_.clear();
+        booleans_.clear();
+        strings_.clear();
+    }
+
+    /**
+     * Passes the pending writes on to target, which has set_integer, set_real, set_boolean and set_string
+     * functions taking a value reference array, its size and a value array, e.g. fmi2::cs_slave_handle.
+     * Every base type is written, also after a call for another one fails, and false is returned if any call failed.
+     * The buffer is empty afterwards.
+     */
+    template<typename Target>
+    bool flush(Target& target)
+    {
+        bool ok = true;
+        if (integers_.count > 0) {
+            ok &= target.set_integer(integers_.vrs.data(), integers_.count, integers_.values.data());
+        }
+        if (reals_.count > 0) {
+            ok &= target.set_real(reals_.vrs.data(), reals_.count, reals_.values.data());
+        }
+        if (booleans_.count > 0) {
+            ok &= target.set_boolean(booleans_.vrs.data(), booleans_.count, booleans_.values.data());
+        }
+        if (strings_.count > 0) {
+            stringPointers_.clear();
+            for (size_t i = 0; i < strings_.count; i++) {
+                stringPointers_.push_back(strings_.values[i].c_str());
+            }
+            ok &= target.set_string(strings_.vrs.data(), strings_.count, stringPointers_.data());
+        }
+        clear();
+        return ok;
+    }
+};
+
+} // namespace fmi4cpp
+
+#endif //FMI4CPP_WRITEBUFFER_HPP
@@ -0,0 +1,229 @@
+
+#include <fmi4cpp/conversions.hpp>
+
+#include <algorithm>
+#include <limits>
+
+#if defined(__AVX2__)
+#    include <immintrin.h>
+#    define FMI4CPP_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    include <emmintrin.h>
+#    define FMI4CPP_SSE2
+#endif
+
+using namespace fmi4cpp;
+
+namespace
+{
+
+template<typename T>
+T saturate(fmi4cppInteger value)
+{
+    return static_cast<T>(std::clamp<fmi4cppInteger>(value, std::numeric_limits<T>::min(), std::numeric_limits<T>::max()));
+}
+
+} // namespace
+
+void fmi4cpp::booleans_to_bytes(const fmi4cppBoolean* values, size_t n, uint8_t* bytes)
+{
+    size_t i = 0;
+#if defined(FMI4CPP_AVX2)
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i ones = _mm256_set1_epi8(1);
+    // packs work within 128 bit lanes, the permutation puts the four groups of eight bytes back in order
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    for (; i + 32 <= n; i += 32) {
+        const auto* in = reinterpret_cast<const __m256i*>(values + i);
+        const __m256i a = _mm256_cmpeq_epi32(_mm256_loadu_si256(in), zero);
+        const __m256i b = _mm256_cmpeq_epi32(_mm256_loadu_si256(in + 1), zero);
+        const __m256i c = _mm256_cmpeq_epi32(_mm256_loadu_si256(in + 2), zero);
+        const __m256i d = _mm256_cmpeq_epi32(_mm256_loadu_si256(in + 3), zero);
+        const __m256i packed = _mm256_packs_epi16(_mm256_packs_epi32(a, b), _mm256_packs_epi32(c, d));
+        const __m256i isZero = _mm256_permutevar8x32_epi32(packed, order);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(bytes + i), _mm256_andnot_si256(isZero, ones));
+    }
+#elif defined(FMI4CPP_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i ones = _mm_set1_epi8(1);
+    for (; i + 16 <= n; i += 16) {
+        const auto* in = reinterpret_cast<const __m128i*>(values + i);
+        const __m128i a = _mm_cmpeq_epi32(_mm_loadu_si128(in), zero);
+        const __m128i b = _mm_cmpeq_epi32(_mm_loadu_si128(in + 1), zero);
+        const __m128i c = _mm_cmpeq_epi32(_mm_loadu_si128(in + 2), zero);
+        const __m128i d = _mm_cmpeq_epi32(_mm_loadu_si128(in + 3), zero);
+        const __m128i isZero = _mm_packs_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(bytes + i), _mm_andnot_si128(isZero, ones));
+    }
+#endif
+    for (; i < n; i++) {
+        bytes[i] = values[i] != 0;
+    }
+}
+
+void fmi4cpp::bytes_to_booleans(const uint8_t* bytes, size_t n, fmi4cppBoolean* values)
+{
+    size_t i = 0;
+#if defined(FMI4CPP_AVX2)
+    const __m256i ones = _mm256_set1_epi32(1);
+    for (size_t end = n - n % 8; i < end; i += 8) {
+        const __m256i widened = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(bytes + i)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(values + i), _mm256_min_epu32(widened, ones));
+    }
+#elif defined(FMI4CPP_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i ones = _mm_set1_epi8(1);
+    for (; i + 16 <= n; i += 16) {
+        const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i));
+        const __m128i normalized = _mm_min_epu8(in, ones);
+        const __m128i lo = _mm_unpacklo_epi8(normalized, zero);
+        const __m128i hi = _mm_unpackhi_epi8(normalized, zero);
+        auto* out = reinterpret_cast<__m128i*>(values + i);
+        _mm_storeu_si128(out, _mm_unpacklo_epi16(lo, zero));
+        _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(lo, zero));
+        _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(hi, zero));
+        _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(hi, zero));
+    }
+#endif
+    for (; i < n; i++) {
+        values[i] = bytes[i] != 0;
+    }
+}
+
+void fmi4cpp::booleans_to_bits(const fmi4cppBoolean* values, size_t n, uint64_t* bits)
+{
+    for (size_t word = 0; word * 64 < n; word++) {
+        const size_t begin = word * 64;
+        const size_t end = std::min(begin + 64, n);
+        uint64_t packed = 0;
+        size_t i = begin;
+        if (end - begin == 64) {
+#if defined(FMI4CPP_AVX2)
+            const __m256i zero = _mm256_setzero_si256();
+            for (; i < end; i += 8) {
+                const __m256i isZero = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i)), zero);
+                const auto mask = static_cast<uint64_t>(_mm256_movemask_ps(_mm256_castsi256_ps(isZero)));
+                packed |= (~mask & 0xFFu) << (i - begin);
+            }
+#elif defined(FMI4CPP_SSE2)
+            const __m128i zero = _mm_setzero_si128();
+            for (; i < end; i += 4) {
+                const __m128i isZero = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i)), zero);
+                const auto mask = static_cast<uint64_t>(_mm_movemask_ps(_mm_castsi128_ps(isZero)));
+                packed |= (~mask & 0xFu) << (i - begin);
+            }
+#endif
+        }
+        for (; i < end; i++) {
+            packed |= static_cast<uint64_t>(values[i] != 0) << (i - begin);
+        }
+        bits[word] = packed;
+    }
+}
+
+void fmi4cpp::bits_to_booleans(const uint64_t* bits, size_t n, fmi4cppBoolean* values)
+{
+    size_t i = 0;
+#if defined(FMI4CPP_AVX2)
+    const __m256i select = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+    for (size_t end = n - n % 8; i < end; i += 8) {
+        const auto byte = static_cast<int>((bits[i / 64] >> (i % 64)) & 0xFFu);
+        const __m256i set = _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(byte), select), select);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(values + i), _mm256_srli_epi32(set, 31));
+    }
+#elif defined(FMI4CPP_SSE2)
+    const __m128i select = _mm_setr_epi32(1, 2, 4, 8);
+    for (size_t end = n - n % 4; i < end; i += 4) {
+        const auto nibble = static_cast<int>((bits[i / 64] >> (i % 64)) & 0xFu);
+        const __m128i set = _mm_cmpeq_epi32(_mm_and_si128(_mm_set1_epi32(nibble), select), select);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(values + i), _mm_srli_epi32(set, 31));
+    }
+#endif
+    for (; i < n; i++) {
+        values[i] = static_cast<fmi4cppBoolean>((bits[i / 64] >> (i % 64)) & 1u);
+    }
+}
+
+void fmi4cpp::narrow_integers(const fmi4cppInteger* values, size_t n, int16_t* narrowed)
+{
+    size_t i = 0;
+#if defined(FMI4CPP_AVX2)
+    for (; i + 16 <= n; i += 16) {
+        const auto* in = reinterpret_cast<const __m256i*>(values + i);
+        const __m256i packed = _mm256_packs_epi32(_mm256_loadu_si256(in), _mm256_loadu_si256(in + 1));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(narrowed + i), _mm256_permute4x64_epi64(packed, 0xD8));
+    }
+#elif defined(FMI4CPP_SSE2)
+    for (; i + 8 <= n; i += 8) {
+        const auto* in = reinterpret_cast<const __m128i*>(values + i);
+        const __m128i packed = _mm_packs_epi32(_mm_loadu_si128(in), _mm_loadu_si128(in + 1));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(narrowed + i), packed);
+    }
+#endif
+    for (; i < n; i++) {
+        narrowed[i] = saturate<int16_t>(values[i]);
+    }
+}
+
+void fmi4cpp::narrow_integers(const fmi4cppInteger* values, size_t n, int8_t* narrowed)
+{
+    size_t i = 0;
+#if defined(FMI4CPP_SSE2) || defined(FMI4CPP_AVX2)
+    for (; i + 16 <= n; i += 16) {
+        const auto* in = reinterpret_cast<const __m128i*>(values + i);
+        const __m128i lo = _mm_packs_epi32(_mm_loadu_si128(in), _mm_loadu_si128(in + 1));
+        const __m128i hi = _mm_packs_epi32(_mm_loadu_si128(in + 2), _mm_loadu_si128(in + 3));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(narrowed + i), _mm_packs_epi16(lo, hi));
+    }
+#endif
+    for (; i < n; i++) {
+        narrowed[i] = saturate<int8_t>(values[i]);
+    }
+}
+
+void fmi4cpp::widen_integers(const int16_t* narrowed, size_t n, fmi4cppInteger* values)
+{
+    size_t i = 0;
+#if defined(FMI4CPP_AVX2)
+    for (; i + 8 <= n; i += 8) {
+        const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(narrowed + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(values + i), _mm256_cvtepi16_epi32(in));
+    }
+#elif defined(FMI4CPP_SSE2)
+    for (; i + 8 <= n; i += 8) {
+        const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(narrowed + i));
+        auto* out = reinterpret_cast<__m128i*>(values + i);
+        // duplicate each value into both halves of a 32 bit lane, then shift down to sign extend
+        _mm_storeu_si128(out, _mm_srai_epi32(_mm_unpacklo_epi16(in, in), 16));
+        _mm_storeu_si128(out + 1, _mm_srai_epi32(_mm_unpackhi_epi16(in, in), 16));
+    }
+#endif
+    for (; i < n; i++) {
+        values[i] = narrowed[i];
+    }
+}
+
+void fmi4cpp::widen_integers(const int8_t* narrowed, size_t n, fmi4cppInteger* values)
+{
+    size_t i = 0;
+#if defined(FMI4CPP_AVX2)
+    for (; i + 8 <= n; i += 8) {
+        const __m128i in = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(narrowed + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(values + i), _mm256_cvtepi8_epi32(in));
+    }
+#elif defined(FMI4CPP_SSE2)
+    for (; i + 16 <= n; i += 16) {
+        const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(narrowed + i));
+        const __m128i lo = _mm_unpacklo_epi8(in, in);
+        const __m128i hi = _mm_unpackhi_epi8(in, in);
+        auto* out = reinterpret_cast<__m128i*>(values + i);
+        _mm_storeu_si128(out, _mm_srai_epi32(_mm_unpacklo_epi16(lo, lo), 24));
+        _mm_storeu_si128(out + 1, _mm_srai_epi32(_mm_unpackhi_epi16(lo, lo), 24));
+        _mm_storeu_si128(out + 2, _mm_srai_epi32(_mm_unpacklo_epi16(hi, hi), 24));
+        _mm_storeu_si128(out + 3, _mm_srai_epi32(_mm_unpackhi_epi16(hi, hi), 24));
+    }
+#endif
+    for (; i < n; i++) {
+        values[i] = narrowed[i];
+    }
+}
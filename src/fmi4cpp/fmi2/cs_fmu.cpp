@@ -24,12 +24,12 @@ std::shared_ptr<const cs_model_description> cs_fmu::get_model_description() cons
 
 std::unique_ptr<cs_slave> cs_fmu::new_instance(const bool visible, const bool loggingOn)
 {
-    std::shared_ptr<cs_library> lib = nullptr;
     auto modelIdentifier = modelDescription_->model_identifier;
     if (lib_ == nullptr) {
         lib_ = std::make_shared<cs_library>(modelIdentifier, resource_);
     }
-    lib = lib_;
+    // each instance gets its own copy, sharing the loaded library but not the status
+    auto lib = std::make_shared<cs_library>(*lib_);
 
     auto c = lib->instantiate(modelIdentifier, fmi2CoSimulation, guid(),
         resource_->resource_path(), visible, loggingOn);
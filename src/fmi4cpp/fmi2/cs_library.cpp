@@ -10,19 +10,19 @@ cs_library::cs_library(const std::string& modelIdentifier,
     : fmi2_library(modelIdentifier, resource)
 {
 
-    fmi2SetRealInputDerivatives_ = load_function<fmi2SetRealInputDerivativesTYPE*>(handle_,
+    functions_.set_real_input_derivatives = load_function<fmi2SetRealInputDerivativesTYPE*>(handle_,
         "fmi2SetRealInputDerivatives");
-    fmi2GetRealOutputDerivatives_ = load_function<fmi2GetRealOutputDerivativesTYPE*>(handle_,
+    functions_.get_real_output_derivatives = load_function<fmi2GetRealOutputDerivativesTYPE*>(handle_,
         "fmi2GetRealOutputDerivatives");
 
-    fmi2DoStep_ = load_function<fmi2DoStepTYPE*>(handle_, "fmi2DoStep");
-    fmi2CancelStep_ = load_function<fmi2CancelStepTYPE*>(handle_, "fmi2CancelStep");
+    functions_.do_step = load_function<fmi2DoStepTYPE*>(handle_, "fmi2DoStep");
+    functions_.cancel_step = load_function<fmi2CancelStepTYPE*>(handle_, "fmi2CancelStep");
 
-    fmi2GetStatus_ = load_function<fmi2GetStatusTYPE*>(handle_, "fmi2GetStatusTYPE");
-    fmi2GetRealStatus_ = load_function<fmi2GetRealStatusTYPE*>(handle_, "fmi2GetRealStatusTYPE");
-    fmi2GetIntegerStatus_ = load_function<fmi2GetIntegerStatusTYPE*>(handle_, "fmi2GetIntegerStatusTYPE");
-    fmi2GetBooleanStatus_ = load_function<fmi2GetBooleanStatusTYPE*>(handle_, "fmi2GetBooleanStatusTYPE");
-    fmi2GetStringStatus_ = load_function<fmi2GetStringStatusTYPE*>(handle_, "fmi2GetStringStatusTYPE");
+    functions_.get_status = load_function<fmi2GetStatusTYPE*>(handle_, "fmi2GetStatus");
+    functions_.get_real_status = load_function<fmi2GetRealStatusTYPE*>(handle_, "fmi2GetRealStatus");
+    functions_.get_integer_status = load_function<fmi2GetIntegerStatusTYPE*>(handle_, "fmi2GetIntegerStatus");
+    functions_.get_boolean_status = load_function<fmi2GetBooleanStatusTYPE*>(handle_, "fmi2GetBooleanStatus");
+    functions_.get_string_status = load_function<fmi2GetStringStatusTYPE*>(handle_, "fmi2GetStringStatus");
 }
 
 bool cs_library::step(
@@ -32,12 +32,12 @@ bool cs_library::step(
     const bool noSetFMUStatePriorToCurrentPoint)
 {
     return update_status_and_return_true_if_ok(
-        fmi2DoStep_(c, currentCommunicationPoint, communicationStepSize, noSetFMUStatePriorToCurrentPoint));
+        functions_.do_step(c, currentCommunicationPoint, communicationStepSize, noSetFMUStatePriorToCurrentPoint));
 }
 
 bool cs_library::cancel_step(fmi2Component c)
 {
-    return update_status_and_return_true_if_ok(fmi2CancelStep_(c));
+    return update_status_and_return_true_if_ok(functions_.cancel_step(c));
 }
 
 bool cs_library::set_real_input_derivatives(
@@ -46,7 +46,7 @@ bool cs_library::set_real_input_derivatives(
     const std::vector<fmi2Integer>& order,
     const std::vector<fmi2Real>& value)
 {
-    return update_status_and_return_true_if_ok(fmi2SetRealInputDerivatives_(c, vr.data(), vr.size(), order.data(), value.data()));
+    return update_status_and_return_true_if_ok(functions_.set_real_input_derivatives(c, vr.data(), vr.size(), order.data(), value.data()));
 }
 
 bool cs_library::get_real_output_derivatives(
@@ -56,7 +56,7 @@ bool cs_library::get_real_output_derivatives(
     std::vector<fmi2Real>& value)
 {
     return update_status_and_return_true_if_ok(
-        fmi2GetRealOutputDerivatives_(c, vr.data(), vr.size(), order.data(), value.data()));
+        functions_.get_real_output_derivatives(c, vr.data(), vr.size(), order.data(), value.data()));
 }
 
 bool cs_library::get_status(
@@ -65,7 +65,7 @@ bool cs_library::get_status(
     fmi2Status& value)
 {
     return update_status_and_return_true_if_ok(
-        fmi2GetStatus_(c, s, &value));
+        functions_.get_status(c, s, &value));
 }
 
 bool cs_library::get_real_status(
@@ -74,7 +74,7 @@ bool cs_library::get_real_status(
     fmi2Real& value)
 {
     return update_status_and_return_true_if_ok(
-        fmi2GetRealStatus_(c, s, &value));
+        functions_.get_real_status(c, s, &value));
 }
 
 bool cs_library::get_integer_status(
@@ -83,7 +83,7 @@ bool cs_library::get_integer_status(
     fmi2Integer& value)
 {
     return update_status_and_return_true_if_ok(
-        fmi2GetIntegerStatus_(c, s, &value));
+        functions_.get_integer_status(c, s, &value));
 }
 
 bool cs_library::get_boolean_status(
@@ -92,7 +92,7 @@ bool cs_library::get_boolean_status(
     fmi2Boolean& value)
 {
     return update_status_and_return_true_if_ok(
-        fmi2GetBooleanStatus_(c, s, &value));
+        functions_.get_boolean_status(c, s, &value));
 }
 
 bool cs_library::get_string_status(
@@ -101,5 +101,5 @@ bool cs_library::get_string_status(
     fmi2String& value)
 {
     return update_status_and_return_true_if_ok(
-        fmi2GetStringStatus_(c, s, &value));
+        functions_.get_string_status(c, s, &value));
 }
@@ -1,14 +1,52 @@
 
 #include <fmi4cpp/fmi2/cs_slave.hpp>
 #include <fmi4cpp/fmi2/status_converter.hpp>
+#include <fmi4cpp/fmi2/xml/cs_model_description.hpp>
+
+#include <numeric>
 
 using namespace fmi4cpp::fmi2;
 
+namespace
+{
+
+template<fmi4cpp::base_type Type, typename Read>
+bool read_through(fmi4cpp::value_cache* cache, const fmi2ValueReference* vr, size_t nvr,
+    typename fmi4cpp::base_type_traits<Type>::value_type* ref, Read&& read)
+{
+    if (cache == nullptr) {
+        return read(vr, nvr, ref);
+    }
+    if (cache->get<Type>(vr, nvr, ref)) {
+        return true;
+    }
+    if (!read(vr, nvr, ref)) {
+        return false;
+    }
+    cache->put<Type>(vr, nvr, ref);
+    return true;
+}
+
+template<fmi4cpp::base_type Type, typename Read>
+void read_eager(fmi4cpp::value_cache& cache, const std::vector<fmi2ValueReference>& vrs, Read&& read)
+{
+    if (vrs.empty()) {
+        return;
+    }
+    auto& values = cache.scratch<Type>();
+    if (read(vrs.data(), vrs.size(), values.data())) {
+        cache.put<Type>(vrs.data(), vrs.size(), values.data());
+    }
+}
+
+} // namespace
+
 cs_slave::cs_slave(fmi2Component c,
     const std::shared_ptr<fmi4cpp::fmu_resource>& resource,
     const std::shared_ptr<cs_library>& library,
     const std::shared_ptr<const cs_model_description>& modelDescription)
     : fmu_instance_base<cs_library, cs_model_description>(c, resource, library, modelDescription)
+    , fastPath_(c, *library, simulationTime_)
 {}
 
 DLL_HANDLE cs_slave::handle() const
@@ -21,13 +59,70 @@ fmi4cpp::status cs_slave::last_status() const
     return convert(library_->last_status());
 }
 
-bool cs_slave::step(const double stepSize)
+void cs_slave::enable_cache(fmi4cpp::value_reference_set eager)
+{
+    const auto& variables = *modelDescription_->model_variables;
+    std::vector<size_t> all(variables.size());
+    std::iota(all.begin(), all.end(), size_t(0));
+    cache_ = std::make_unique<value_cache>(variables.value_references(all), std::move(eager));
+}
+
+void cs_slave::disable_cache()
+{
+    cache_.reset();
+}
+
+void cs_slave::invalidate_cache()
 {
-    if (library_->step(c_, simulationTime_, stepSize, false)) {
-        simulationTime_ += stepSize;
+    if (cache_) {
+        cache_->invalidate();
+    }
+}
+
+void cs_slave::prefetch()
+{
+    const auto& eager = cache_->eager();
+    read_eager<base_type::integer>(*cache_, eager.integers, [this](auto... args) { return fastPath_.get_integer(args...); });
+    read_eager<base_type::real>(*cache_, eager.reals, [this](auto... args) { return fastPath_.get_real(args...); });
+    read_eager<base_type::boolean>(*cache_, eager.booleans, [this](auto... args) { return fastPath_.get_boolean(args...); });
+}
+
+void cs_slave::enable_write_buffering()
+{
+    if (!writeBuffer_) {
+        writeBuffer_ = std::make_unique<write_buffer>();
+    }
+}
+
+bool cs_slave::disable_write_buffering()
+{
+    const bool ok = flush();
+    writeBuffer_.reset();
+    return ok;
+}
+
+bool cs_slave::flush()
+{
+    if (!writeBuffer_ || writeBuffer_->empty()) {
         return true;
     }
-    return false;
+    return writeBuffer_->flush(fastPath_);
+}
+
+bool cs_slave::step(const double stepSize)
+{
+    if (!flush()) {
+        return false;
+    }
+    if (!cache_) {
+        return fastPath_.step(stepSize);
+    }
+    cache_->invalidate();
+    if (!fastPath_.step(stepSize)) {
+        return false;
+    }
+    prefetch();
+    return true;
 }
 
 bool cs_slave::cancel_step()
@@ -47,16 +142,28 @@ bool cs_slave::setup_experiment(double start, double stop, double tolerance)
 
 bool cs_slave::enter_initialization_mode()
 {
+    invalidate_cache();
+    if (!flush()) {
+        return false;
+    }
     return fmu_instance_base::enter_initialization_mode();
 }
 
 bool cs_slave::exit_initialization_mode()
 {
+    invalidate_cache();
+    if (!flush()) {
+        return false;
+    }
     return fmu_instance_base::exit_initialization_mode();
 }
 
 bool cs_slave::reset()
 {
+    invalidate_cache();
+    if (writeBuffer_) {
+        writeBuffer_->clear();
+    }
     return fmu_instance_base::reset();
 }
 
@@ -67,108 +174,208 @@ bool cs_slave::terminate()
 
 bool cs_slave::read_integer(unsigned int vr, int& ref)
 {
-    return fmu_instance_base::read_integer(vr, ref);
+    return flush() && read_through<base_type::integer>(cache_.get(), &vr, 1, &ref,
+        [this](auto... args) { return fastPath_.get_integer(args...); });
 }
 
 bool cs_slave::read_integer(
     const std::vector<unsigned int>& vr,
     std::vector<int>& ref)
 {
-    return fmu_instance_base::read_integer(vr, ref);
+    return read_integer(vr.data(), vr.size(), ref.data());
+}
+
+bool cs_slave::read_integer(const unsigned int* vr, size_t nvr, int* ref)
+{
+    return flush() && read_through<base_type::integer>(cache_.get(), vr, nvr, ref,
+        [this](auto... args) { return fastPath_.get_integer(args...); });
 }
 
 bool cs_slave::read_real(unsigned int vr, double& ref)
 {
-    return fmu_instance_base::read_real(vr, ref);
+    return flush() && read_through<base_type::real>(cache_.get(), &vr, 1, &ref,
+        [this](auto... args) { return fastPath_.get_real(args...); });
 }
 
 bool cs_slave::read_real(
     const std::vector<unsigned int>& vr,
     std::vector<double>& ref)
 {
-    return fmu_instance_base::read_real(vr, ref);
+    return read_real(vr.data(), vr.size(), ref.data());
+}
+
+bool cs_slave::read_real(const unsigned int* vr, size_t nvr, double* ref)
+{
+    return flush() && read_through<base_type::real>(cache_.get(), vr, nvr, ref,
+        [this](auto... args) { return fastPath_.get_real(args...); });
 }
 
 bool cs_slave::read_string(unsigned int vr, const char*& ref)
 {
-    return fmu_instance_base::read_string(vr, ref);
+    return flush() && fastPath_.get_string(vr, ref);
 }
 
 bool cs_slave::read_string(
     const std::vector<unsigned int>& vr,
     std::vector<const char*>& ref)
 {
-    return fmu_instance_base::read_string(vr, ref);
+    return read_string(vr.data(), vr.size(), ref.data());
+}
+
+bool cs_slave::read_string(const unsigned int* vr, size_t nvr, const char** ref)
+{
+    return flush() && fastPath_.get_string(vr, nvr, ref);
 }
 
 bool cs_slave::read_boolean(unsigned int vr, int& ref)
 {
-    return fmu_instance_base::read_boolean(vr, ref);
+    return flush() && read_through<base_type::boolean>(cache_.get(), &vr, 1, &ref,
+        [this](auto... args) { return fastPath_.get_boolean(args...); });
 }
 
 bool cs_slave::read_boolean(
     const std::vector<unsigned int>& vr,
     std::vector<int>& ref)
 {
-    return fmu_instance_base::read_boolean(vr, ref);
+    return read_boolean(vr.data(), vr.size(), ref.data());
+}
+
+bool cs_slave::read_boolean(const unsigned int* vr, size_t nvr, int* ref)
+{
+    return flush() && read_through<base_type::boolean>(cache_.get(), vr, nvr, ref,
+        [this](auto... args) { return fastPath_.get_boolean(args...); });
 }
 
 bool cs_slave::write_integer(unsigned int vr, int value)
 {
-    return fmu_instance_base::write_integer(vr, value);
+    invalidate_cache();
+    if (writeBuffer_) {
+        writeBuffer_->write_integer(vr, value);
+        return true;
+    }
+    return fastPath_.set_integer(vr, value);
 }
 
 bool cs_slave::write_integer(
     const std::vector<unsigned int>& vr,
     const std::vector<int>& values)
 {
-    return fmu_instance_base::write_integer(vr, values);
+    return write_integer(vr.data(), vr.size(), values.data());
+}
+
+bool cs_slave::write_integer(const unsigned int* vr, size_t nvr, const int* values)
+{
+    invalidate_cache();
+    if (writeBuffer_) {
+        for (size_t i = 0; i < nvr; i++) {
+            writeBuffer_->write_integer(vr[i], values[i]);
+        }
+        return true;
+    }
+    return fastPath_.set_integer(vr, nvr, values);
 }
 
 bool cs_slave::write_real(unsigned int vr, double value)
 {
-    return fmu_instance_base::write_real(vr, value);
+    invalidate_cache();
+    if (writeBuffer_) {
+        writeBuffer_->write_real(vr, value);
+        return true;
+    }
+    return fastPath_.set_real(vr, value);
 }
 
 bool cs_slave::write_real(
     const std::vector<unsigned int>& vr,
     const std::vector<double>& values)
 {
-    return fmu_instance_base::write_real(vr, values);
+    return write_real(vr.data(), vr.size(), values.data());
+}
+
+bool cs_slave::write_real(const unsigned int* vr, size_t nvr, const double* values)
+{
+    invalidate_cache();
+    if (writeBuffer_) {
+        for (size_t i = 0; i < nvr; i++) {
+            writeBuffer_->write_real(vr[i], values[i]);
+        }
+        return true;
+    }
+    return fastPath_.set_real(vr, nvr, values);
 }
 
 bool cs_slave::write_string(unsigned int vr, const char* value)
 {
-    return fmu_instance_base::write_string(vr, value);
+    invalidate_cache();
+    if (writeBuffer_) {
+        writeBuffer_->write_string(vr, value);
+        return true;
+    }
+    return fastPath_.set_string(vr, value);
 }
 
 bool cs_slave::write_string(
     const std::vector<unsigned int>& vr,
     const std::vector<const char*>& values)
 {
-    return fmu_instance_base::write_string(vr, values);
+    return write_string(vr.data(), vr.size(), values.data());
+}
+
+bool cs_slave::write_string(const unsigned int* vr, size_t nvr, const char* const* values)
+{
+    invalidate_cache();
+    if (writeBuffer_) {
+        for (size_t i = 0; i < nvr; i++) {
+            writeBuffer_->write_string(vr[i], values[i]);
+        }
+        return true;
+    }
+    return fastPath_.set_string(vr, nvr, values);
 }
 
 bool cs_slave::write_boolean(unsigned int vr, int value)
 {
-    return fmu_instance_base::write_boolean(vr, value);
+    invalidate_cache();
+    if (writeBuffer_) {
+        writeBuffer_->write_boolean(vr, value);
+        return true;
+    }
+    return fastPath_.set_boolean(vr, value);
 }
 
 bool cs_slave::write_boolean(
     const std::vector<unsigned int>& vr,
     const std::vector<int>& values)
 {
-    return fmu_instance_base::write_boolean(vr, values);
+    return write_boolean(vr.data(), vr.size(), values.data());
 }
 
+bool cs_slave::write_boolean(const unsigned int* vr, size_t nvr, const int* values)
+{
+    invalidate_cache();
+    if (writeBuffer_) {
+        for (size_t i = 0; i < nvr; i++) {
+            writeBuffer_->write_boolean(vr[i], values[i]);
+        }
+        return true;
+    }
+    return fastPath_.set_boolean(vr, nvr, values);
+}
 
 bool cs_slave::get_fmu_state(void*& state)
 {
+    if (!flush()) {
+        return false;
+    }
     return fmu_instance_base::get_fmu_state(state);
 }
 
 bool cs_slave::set_fmu_state(void* state)
 {
+    invalidate_cache();
+    if (writeBuffer_) {
+        writeBuffer_->clear();
+    }
     return fmu_instance_base::set_fmu_state(state);
 }
 
@@ -199,6 +406,9 @@ bool cs_slave::get_directional_derivative(
     const std::vector<double>& dvKnownRef,
     std::vector<double>& dvUnknownRef)
 {
+    if (!flush()) {
+        return false;
+    }
     return fmu_instance_base::get_directional_derivative(
         vUnknownRef, vKnownRef, dvKnownRef, dvUnknownRef);
 }
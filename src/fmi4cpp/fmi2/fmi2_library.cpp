@@ -1,7 +1,9 @@
 
 #include <fmi4cpp/fmi2/fmi2_library.hpp>
+#include <fmi4cpp/fmi2/status_converter.hpp>
 #include <fmi4cpp/fs_portability.hpp>
 #include <fmi4cpp/library_helper.hpp>
+#include <fmi4cpp/log_pipeline.hpp>
 #include <fmi4cpp/mlog.hpp>
 #include <fmi4cpp/tools/os_util.hpp>
 
@@ -14,38 +16,13 @@ using namespace fmi4cpp::fmi2;
 namespace
 {
 
-std::string to_string(fmi2Status status)
-{
-    switch (status) {
-        case fmi2OK:
-            return "OK";
-        case fmi2Warning:
-            return "Warning";
-        case fmi2Discard:
-            return "Discard";
-        case fmi2Error:
-            return "Error";
-        case fmi2Fatal:
-            return "Fatal";
-        case fmi2Pending:
-            return "Pending";
-        default:
-            return "Unknown";
-    }
-}
-
 void logger(void* fmi2ComponentEnvironment, fmi2String instance_name, fmi2Status status, fmi2String category,
     fmi2String message, ...)
 {
-    char msg[1000];
     va_list argp;
-
     va_start(argp, message);
-    vsprintf(msg, message, argp);
+    log_pipeline::instance().push(instance_name, convert(status), category, message, argp);
     va_end(argp);
-
-    MLOG_INFO("[FMI callback logger] status=" + to_string(status) + ", instanceName=" + instance_name +
-        ", category=" + category + ", message=" + msg);
 }
 
 const fmi2CallbackFunctions callback = {
@@ -68,42 +45,51 @@ fmi2_library::fmi2_library(const std::string& modelIdentifier, const std::shared
         MLOG_ERROR(err);
         throw std::runtime_error(err);
     }
+    sharedHandle_ = std::shared_ptr<void>(handle_, [](void* handle) {
+        if (!free_library(static_cast<DLL_HANDLE>(handle))) {
+            MLOG_ERROR(getLastError());
+        }
+    });
 
-    fmi2GetVersion_ = load_function<fmi2GetVersionTYPE*>(handle_, "fmi2GetVersion");
-    fmi2GetTypesPlatform_ = load_function<fmi2GetTypesPlatformTYPE*>(handle_, "fmi2GetTypesPlatform");
+    functions_.callbacks = &callback;
 
-    fmi2SetDebugLogging_ = load_function<fmi2SetDebugLoggingTYPE*>(handle_, "fmi2SetDebugLogging");
+    functions_.get_version = load_function<fmi2GetVersionTYPE*>(handle_, "fmi2GetVersion");
+    functions_.get_types_platform = load_function<fmi2GetTypesPlatformTYPE*>(handle_, "fmi2GetTypesPlatform");
 
-    fmi2Instantiate_ = load_function<fmi2InstantiateTYPE*>(handle_, "fmi2Instantiate");
-    fmi2SetupExperiment_ = load_function<fmi2SetupExperimentTYPE*>(handle_, "fmi2SetupExperiment");
-    fmi2EnterInitializationMode_ = load_function<fmi2EnterInitializationModeTYPE*>(handle_,
+    functions_.set_debug_logging = load_function<fmi2SetDebugLoggingTYPE*>(handle_, "fmi2SetDebugLogging");
+
+    functions_.instantiate = load_function<fmi2InstantiateTYPE*>(handle_, "fmi2Instantiate");
+    functions_.setup_experiment = load_function<fmi2SetupExperimentTYPE*>(handle_, "fmi2SetupExperiment");
+    functions_.enter_initialization_mode = load_function<fmi2EnterInitializationModeTYPE*>(handle_,
         "fmi2EnterInitializationMode");
-    fmi2ExitInitializationMode_ = load_function<fmi2ExitInitializationModeTYPE*>(handle_,
+    functions_.exit_initialization_mode = load_function<fmi2ExitInitializationModeTYPE*>(handle_,
         "fmi2ExitInitializationMode");
 
-    fmi2Reset_ = load_function<fmi2ResetTYPE*>(handle_, "fmi2Reset");
-    fmi2Terminate_ = load_function<fmi2TerminateTYPE*>(handle_, "fmi2Terminate");
+    functions_.reset = load_function<fmi2ResetTYPE*>(handle_, "fmi2Reset");
+    functions_.terminate = load_function<fmi2TerminateTYPE*>(handle_, "fmi2Terminate");
 
-    fmi2GetInteger_ = load_function<fmi2GetIntegerTYPE*>(handle_, "fmi2GetInteger");
-    fmi2GetReal_ = load_function<fmi2GetRealTYPE*>(handle_, "fmi2GetReal");
-    fmi2GetString_ = load_function<fmi2GetStringTYPE*>(handle_, "fmi2GetString");
-    fmi2GetBoolean_ = load_function<fmi2GetBooleanTYPE*>(handle_, "fmi2GetBoolean");
+    functions_.get_integer = load_function<fmi2GetIntegerTYPE*>(handle_, "fmi2GetInteger");
+    functions_.get_real = load_function<fmi2GetRealTYPE*>(handle_, "fmi2GetReal");
+    functions_.get_string = load_function<fmi2GetStringTYPE*>(handle_, "fmi2GetString");
+    functions_.get_boolean = load_function<fmi2GetBooleanTYPE*>(handle_, "fmi2GetBoolean");
 
-    fmi2SetInteger_ = load_function<fmi2SetIntegerTYPE*>(handle_, "fmi2SetInteger");
-    fmi2SetReal_ = load_function<fmi2SetRealTYPE*>(handle_, "fmi2SetReal");
-    fmi2SetString_ = load_function<fmi2SetStringTYPE*>(handle_, "fmi2SetString");
-    fmi2SetBoolean_ = load_function<fmi2SetBooleanTYPE*>(handle_, "fmi2SetBoolean");
+    functions_.set_integer = load_function<fmi2SetIntegerTYPE*>(handle_, "fmi2SetInteger");
+    functions_.set_real = load_function<fmi2SetRealTYPE*>(handle_, "fmi2SetReal");
+    functions_.set_string = load_function<fmi2SetStringTYPE*>(handle_, "fmi2SetString");
+    functions_.set_boolean = load_function<fmi2SetBooleanTYPE*>(handle_, "fmi2SetBoolean");
 
-    fmi2GetFMUstate_ = load_function<fmi2GetFMUstateTYPE*>(handle_, "fmi2GetFMUstate");
-    fmi2SetFMUstate_ = load_function<fmi2SetFMUstateTYPE*>(handle_, "fmi2SetFMUstate");
-    fmi2FreeFMUstate_ = load_function<fmi2FreeFMUstateTYPE*>(handle_, "fmi2FreeFMUstate");
-    fmi2SerializeFMUstate_ = load_function<fmi2SerializeFMUstateTYPE*>(handle_, "fmi2SerializeFMUstate");
-    fmi2DeSerializeFMUstate_ = load_function<fmi2DeSerializeFMUstateTYPE*>(handle_, "fmi2DeSerializeFMUstate");
+    functions_.get_fmu_state = load_function<fmi2GetFMUstateTYPE*>(handle_, "fmi2GetFMUstate");
+    functions_.set_fmu_state = load_function<fmi2SetFMUstateTYPE*>(handle_, "fmi2SetFMUstate");
+    functions_.free_fmu_state = load_function<fmi2FreeFMUstateTYPE*>(handle_, "fmi2FreeFMUstate");
+    functions_.serialized_fmu_state_size = load_function<fmi2SerializedFMUstateSizeTYPE*>(handle_,
+        "fmi2SerializedFMUstateSize");
+    functions_.serialize_fmu_state = load_function<fmi2SerializeFMUstateTYPE*>(handle_, "fmi2SerializeFMUstate");
+    functions_.de_serialize_fmu_state = load_function<fmi2DeSerializeFMUstateTYPE*>(handle_, "fmi2DeSerializeFMUstate");
 
-    fmi2GetDirectionalDerivative_ = load_function<fmi2GetDirectionalDerivativeTYPE*>(handle_,
+    functions_.get_directional_derivative = load_function<fmi2GetDirectionalDerivativeTYPE*>(handle_,
         "fmi2GetDirectionalDerivative");
 
-    fmi2FreeInstance_ = load_function<fmi2FreeInstanceTYPE*>(handle_, "fmi2FreeInstance");
+    functions_.free_instance = load_function<fmi2FreeInstanceTYPE*>(handle_, "fmi2FreeInstance");
 }
 
 bool fmi2_library::update_status_and_return_true_if_ok(fmi2Status status)
@@ -124,20 +110,20 @@ fmi2Status fmi2_library::last_status() const
 
 fmi2String fmi2_library::get_version() const
 {
-    return fmi2GetVersion_();
+    return functions_.get_version();
 }
 
 fmi2String fmi2_library::get_types_platform() const
 {
-    return fmi2GetTypesPlatform_();
+    return functions_.get_types_platform();
 }
 
 fmi2Component fmi2_library::instantiate(const std::string& instanceName, const fmi2Type type,
     const std::string& guid, const std::string& resourceLocation,
     bool visible, bool loggingOn)
 {
-    fmi2Component c = fmi2Instantiate_(instanceName.c_str(), type, guid.c_str(),
-        resourceLocation.c_str(), &callback, visible, loggingOn);
+    fmi2Component c = functions_.instantiate(instanceName.c_str(), type, guid.c_str(),
+        resourceLocation.c_str(), functions_.callbacks, visible, loggingOn);
 
     if (c == nullptr) {
         const std::string msg = "Fatal: fmi2Instantiate returned nullptr, unable to instantiate FMU instance!";
@@ -145,6 +131,7 @@ fmi2Component fmi2_library::instantiate(const std::string& instanceName, const f
         throw std::runtime_error(msg);
     }
 
+    functions_.component = c;
     return c;
 }
 
@@ -152,7 +139,7 @@ bool fmi2_library::set_debug_logging(fmi2Component c, bool loggingOn,
     std::vector<fmi2String> categories)
 {
     return update_status_and_return_true_if_ok(
-        fmi2SetDebugLogging_(c, loggingOn, categories.size(), categories.data()));
+        functions_.set_debug_logging(c, loggingOn, categories.size(), categories.data()));
 }
 
 bool fmi2_library::setup_experiment(fmi2Component c, double tolerance, double startTime, double stopTime)
@@ -165,31 +152,31 @@ bool fmi2_library::setup_experiment(fmi2Component c, double tolerance, double st
         << ", startTime=" << startTime
         << ", stopTimeDefined=" << std::string((stopDefined ? "true" : "false")) << ", stop=" << stopTime)
     return update_status_and_return_true_if_ok(
-        fmi2SetupExperiment_(c, toleranceDefined, tolerance, startTime, stopDefined, stopTime));
+        functions_.setup_experiment(c, toleranceDefined, tolerance, startTime, stopDefined, stopTime));
 }
 
 bool fmi2_library::enter_initialization_mode(fmi2Component c)
 {
     return update_status_and_return_true_if_ok(
-        fmi2EnterInitializationMode_(c));
+        functions_.enter_initialization_mode(c));
 }
 
 bool fmi2_library::exit_initialization_mode(fmi2Component c)
 {
     return update_status_and_return_true_if_ok(
-        fmi2ExitInitializationMode_(c));
+        functions_.exit_initialization_mode(c));
 }
 
 bool fmi2_library::reset(fmi2Component c)
 {
     return update_status_and_return_true_if_ok(
-        fmi2Reset_(c));
+        functions_.reset(c));
 }
 
 bool fmi2_library::terminate(fmi2Component c)
 {
     return update_status_and_return_true_if_ok(
-        fmi2Terminate_(c));
+        functions_.terminate(c));
 }
 
 bool fmi2_library::read_integer(
@@ -198,16 +185,25 @@ bool fmi2_library::read_integer(
     fmi2Integer& ref)
 {
     return update_status_and_return_true_if_ok(
-        fmi2GetInteger_(c, &vr, 1, &ref));
+        functions_.get_integer(c, &vr, 1, &ref));
 }
 
 bool fmi2_library::read_integer(
     fmi2Component c,
     const std::vector<fmi2ValueReference>& vr,
     std::vector<fmi2Integer>& ref)
+{
+    return read_integer(c, vr.data(), vr.size(), ref.data());
+}
+
+bool fmi2_library::read_integer(
+    fmi2Component c,
+    const fmi2ValueReference* vr,
+    size_t nvr,
+    fmi2Integer* ref)
 {
     return update_status_and_return_true_if_ok(
-        fmi2GetInteger_(c, vr.data(), vr.size(), ref.data()));
+        functions_.get_integer(c, vr, nvr, ref));
 }
 
 bool fmi2_library::read_real(
@@ -216,16 +212,25 @@ bool fmi2_library::read_real(
     fmi2Real& ref)
 {
     return update_status_and_return_true_if_ok(
-        fmi2GetReal_(c, &vr, 1, &ref));
+        functions_.get_real(c, &vr, 1, &ref));
 }
 
 bool fmi2_library::read_real(
     fmi2Component c,
     const std::vector<fmi2ValueReference>& vr,
     std::vector<fmi2Real>& ref)
+{
+    return read_real(c, vr.data(), vr.size(), ref.data());
+}
+
+bool fmi2_library::read_real(
+    fmi2Component c,
+    const fmi2ValueReference* vr,
+    size_t nvr,
+    fmi2Real* ref)
 {
     return update_status_and_return_true_if_ok(
-        fmi2GetReal_(c, vr.data(), vr.size(), ref.data()));
+        functions_.get_real(c, vr, nvr, ref));
 }
 
 bool fmi2_library::read_string(
@@ -234,16 +239,25 @@ bool fmi2_library::read_string(
     fmi2String& ref)
 {
     return update_status_and_return_true_if_ok(
-        fmi2GetString_(c, &vr, 1, &ref));
+        functions_.get_string(c, &vr, 1, &ref));
 }
 
 bool fmi2_library::read_string(
     fmi2Component c,
     const std::vector<fmi2ValueReference>& vr,
     std::vector<fmi2String>& ref)
+{
+    return read_string(c, vr.data(), vr.size(), ref.data());
+}
+
+bool fmi2_library::read_string(
+    fmi2Component c,
+    const fmi2ValueReference* vr,
+    size_t nvr,
+    fmi2String* ref)
 {
     return update_status_and_return_true_if_ok(
-        fmi2GetString_(c, vr.data(), vr.size(), ref.data()));
+        functions_.get_string(c, vr, nvr, ref));
 }
 
 bool fmi2_library::read_boolean(
@@ -252,16 +266,25 @@ bool fmi2_library::read_boolean(
     fmi2Boolean& ref)
 {
     return update_status_and_return_true_if_ok(
-        fmi2GetBoolean_(c, &vr, 1, &ref));
+        functions_.get_boolean(c, &vr, 1, &ref));
 }
 
 bool fmi2_library::read_boolean(
     fmi2Component c,
     const std::vector<fmi2ValueReference>& vr,
     std::vector<fmi2Boolean>& ref)
+{
+    return read_boolean(c, vr.data(), vr.size(), ref.data());
+}
+
+bool fmi2_library::read_boolean(
+    fmi2Component c,
+    const fmi2ValueReference* vr,
+    size_t nvr,
+    fmi2Boolean* ref)
 {
     return update_status_and_return_true_if_ok(
-        fmi2GetBoolean_(c, vr.data(), vr.size(), ref.data()));
+        functions_.get_boolean(c, vr, nvr, ref));
 }
 
 bool fmi2_library::write_integer(
@@ -270,16 +293,25 @@ bool fmi2_library::write_integer(
     const fmi2Integer& value)
 {
     return update_status_and_return_true_if_ok(
-        fmi2SetInteger_(c, &vr, 1, &value));
+        functions_.set_integer(c, &vr, 1, &value));
 }
 
 bool fmi2_library::write_integer(
     fmi2Component c,
     const std::vector<fmi2ValueReference>& vr,
     const std::vector<fmi2Integer>& values)
+{
+    return write_integer(c, vr.data(), vr.size(), values.data());
+}
+
+bool fmi2_library::write_integer(
+    fmi2Component c,
+    const fmi2ValueReference* vr,
+    size_t nvr,
+    const fmi2Integer* values)
 {
     return update_status_and_return_true_if_ok(
-        fmi2SetInteger_(c, vr.data(), vr.size(), values.data()));
+        functions_.set_integer(c, vr, nvr, values));
 }
 
 bool fmi2_library::write_real(
@@ -288,16 +320,25 @@ bool fmi2_library::write_real(
     const fmi2Real& value)
 {
     return update_status_and_return_true_if_ok(
-        fmi2SetReal_(c, &vr, 1, &value));
+        functions_.set_real(c, &vr, 1, &value));
 }
 
 bool fmi2_library::write_real(
     fmi2Component c,
     const std::vector<fmi2ValueReference>& vr,
     const std::vector<fmi2Real>& values)
+{
+    return write_real(c, vr.data(), vr.size(), values.data());
+}
+
+bool fmi2_library::write_real(
+    fmi2Component c,
+    const fmi2ValueReference* vr,
+    size_t nvr,
+    const fmi2Real* values)
 {
     return update_status_and_return_true_if_ok(
-        fmi2SetReal_(c, vr.data(), vr.size(), values.data()));
+        functions_.set_real(c, vr, nvr, values));
 }
 
 bool fmi2_library::write_string(
@@ -306,16 +347,25 @@ bool fmi2_library::write_string(
     fmi2String& value)
 {
     return update_status_and_return_true_if_ok(
-        fmi2SetString_(c, &vr, 1, &value));
+        functions_.set_string(c, &vr, 1, &value));
 }
 
 bool fmi2_library::write_string(
     fmi2Component c,
     const std::vector<fmi2ValueReference>& vr,
     const std::vector<fmi2String>& values)
+{
+    return write_string(c, vr.data(), vr.size(), values.data());
+}
+
+bool fmi2_library::write_string(
+    fmi2Component c,
+    const fmi2ValueReference* vr,
+    size_t nvr,
+    const fmi2String* values)
 {
     return update_status_and_return_true_if_ok(
-        fmi2SetString_(c, vr.data(), vr.size(), values.data()));
+        functions_.set_string(c, vr, nvr, values));
 }
 
 bool fmi2_library::write_boolean(
@@ -324,19 +374,25 @@ bool fmi2_library::write_boolean(
     const fmi2Boolean& value)
 {
     return update_status_and_return_true_if_ok(
-        fmi2SetBoolean_(c, &vr, 1, &value));
+        functions_.set_boolean(c, &vr, 1, &value));
 }
 
 bool fmi2_library::write_boolean(
     fmi2Component c,
     const std::vector<fmi2ValueReference>& vr,
     const std::vector<fmi2Boolean>& values)
+{
+    return write_boolean(c, vr.data(), vr.size(), values.data());
+}
+
+bool fmi2_library::write_boolean(
+    fmi2Component c,
+    const fmi2ValueReference* vr,
+    size_t nvr,
+    const fmi2Boolean* values)
 {
     return update_status_and_return_true_if_ok(
-        fmi2SetBoolean_(c,
-            vr.data(),
-            vr.size(),
-            values.data()));
+        functions_.set_boolean(c, vr, nvr, values));
 }
 
 bool fmi2_library::get_fmu_state(
@@ -344,7 +400,7 @@ bool fmi2_library::get_fmu_state(
     fmi2FMUstate& state)
 {
     return update_status_and_return_true_if_ok(
-        fmi2GetFMUstate_(c, &state));
+        functions_.get_fmu_state(c, &state));
 }
 
 bool fmi2_library::set_fmu_state(
@@ -352,7 +408,7 @@ bool fmi2_library::set_fmu_state(
     fmi2FMUstate state)
 {
     return update_status_and_return_true_if_ok(
-        fmi2SetFMUstate_(c, state));
+        functions_.set_fmu_state(c, state));
 }
 
 bool fmi2_library::free_fmu_state(
@@ -360,7 +416,7 @@ bool fmi2_library::free_fmu_state(
     fmi2FMUstate& state)
 {
     return update_status_and_return_true_if_ok(
-        fmi2FreeFMUstate_(c, &state));
+        functions_.free_fmu_state(c, &state));
 }
 
 bool fmi4cpp::fmi2::fmi2_library::get_serialized_fmu_state_size(
@@ -369,7 +425,7 @@ bool fmi4cpp::fmi2::fmi2_library::get_serialized_fmu_state_size(
     size_t& size)
 {
     return update_status_and_return_true_if_ok(
-        fmi2SerializedFMUstateSize_(c, state, &size));
+        functions_.serialized_fmu_state_size(c, state, &size));
 }
 
 bool fmi2_library::serialize_fmu_state(
@@ -381,7 +437,7 @@ bool fmi2_library::serialize_fmu_state(
     get_serialized_fmu_state_size(c, state, size);
     serializedState.reserve(size);
     return update_status_and_return_true_if_ok(
-        fmi2SerializeFMUstate_(c,
+        functions_.serialize_fmu_state(c,
             state,
             serializedState.data(),
             size));
@@ -393,7 +449,7 @@ bool fmi2_library::de_serialize_fmu_state(
     const std::vector<fmi2Byte>& serializedState)
 {
     return update_status_and_return_true_if_ok(
-        fmi2DeSerializeFMUstate_(c,
+        functions_.de_serialize_fmu_state(c,
             serializedState.data(),
             serializedState.size(),
             &state));
@@ -407,7 +463,7 @@ bool fmi2_library::get_directional_derivative(
     std::vector<fmi2Real>& dvUnknownRef)
 {
     return update_status_and_return_true_if_ok(
-        fmi2GetDirectionalDerivative_(c,
+        functions_.get_directional_derivative(c,
             vUnknownRef.data(), vUnknownRef.size(),
             vKnownRef.data(), vKnownRef.size(),
             dvKnownRef.data(), dvUnknownRef.data()));
@@ -415,15 +471,8 @@ bool fmi2_library::get_directional_derivative(
 
 void fmi2_library::free_instance(fmi2Component c)
 {
-    fmi2FreeInstance_(c);
-}
-
-fmi2_library::~fmi2_library()
-{
-    if (handle_) {
-        if (!free_library(handle_)) {
-            MLOG_ERROR(getLastError());
-        }
-        handle_ = nullptr;
+    functions_.free_instance(c);
+    if (c == functions_.component) {
+        functions_.component = nullptr;
     }
 }
@@ -63,12 +63,10 @@ bool fmu::supports_cs() const
 
 std::unique_ptr<cs_fmu> fmu::as_cs_fmu() const
 {
-    std::shared_ptr<const cs_model_description> cs = std::move(modelDescription_->as_cs_description());
-    return std::make_unique<cs_fmu>(resource_, cs);
+    return std::make_unique<cs_fmu>(resource_, modelDescription_->as_cs_description());
 }
 
 std::unique_ptr<me_fmu> fmu::as_me_fmu() const
 {
-    std::shared_ptr<const me_model_description> me = std::move(modelDescription_->as_me_description());
-    return std::make_unique<me_fmu>(resource_, me);
+    return std::make_unique<me_fmu>(resource_, modelDescription_->as_me_description());
 }
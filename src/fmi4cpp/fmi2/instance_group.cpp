@@ -0,0 +1,283 @@
+
+#include <fmi4cpp/fmi2/instance_group.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+using namespace fmi4cpp;
+using namespace fmi4cpp::fmi2;
+
+namespace
+{
+
+template<base_type Type, typename Read>
+bool gather(group_matrix& matrix, const std::vector<fmi2ValueReference>& vrs, size_t member,
+    std::vector<typename base_type_traits<Type>::value_type>& values, Read&& read)
+{
+    if (vrs.empty()) {
+        return true;
+    }
+    values.resize(vrs.size());
+    if (!read(vrs.data(), vrs.size(), values.data())) {
+        return false;
+    }
+    for (size_t i = 0; i < vrs.size(); i++) {
+        matrix.row<Type>(i)[member] = values[i];
+    }
+    return true;
+}
+
+template<base_type Type, typename Write>
+bool scatter(const group_matrix& matrix, const std::vector<fmi2ValueReference>& vrs, size_t member,
+    std::vector<typename base_type_traits<Type>::value_type>& values, Write&& write)
+{
+    if (vrs.empty()) {
+        return true;
+    }
+    values.resize(vrs.size());
+    for (size_t i = 0; i < vrs.size(); i++) {
+        values[i] = matrix.row<Type>(i)[member];
+    }
+    return write(vrs.data(), vrs.size(), values.data());
+}
+
+} // namespace
+
+/**
+ * Worker threads that each run their share of a task, woken up for every task and idle in between.
+ */
+class instance_group::worker_pool
+{
+
+private:
+    std::vector<std::thread> threads_;
+    std::mutex mutex_;
+    std::condition_variable start_;
+    std::condition_variable done_;
+
+    // the current task, type-erased by hand, as a std::function could allocate for every task
+    void (*invoke_)(void* task, size_t index) = nullptr;
+    void* task_ = nullptr;
+    size_t generation_ = 0;
+    size_t pending_ = 0;
+    bool stopping_ = false;
+
+    void work(size_t index)
+    {
+        size_t seen = 0;
+        while (true) {
+            void (*invoke)(void*, size_t);
+            void* task;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                start_.wait(lock, [&] { return stopping_ || generation_ != seen; });
+                if (stopping_) {
+                    return;
+                }
+                seen = generation_;
+                invoke = invoke_;
+                task = task_;
+            }
+            invoke(task, index);
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (--pending_ == 0) {
+                    done_.notify_one();
+                }
+            }
+        }
+    }
+
+public:
+    explicit worker_pool(size_t workers)
+    {
+        for (size_t i = 0; i < workers; i++) {
+            threads_.emplace_back([this, i] { work(i + 1); });
+        }
+    }
+
+    ~worker_pool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        start_.notify_all();
+        for (auto& thread : threads_) {
+            thread.join();
+        }
+    }
+
+    /**
+     * Runs task(0) on the calling thread and task(i) on worker i, returning once all are done.
+     * The task must not throw.
+     */
+    template<typename Task>
+    void run(Task& task)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            invoke_ = [](void* t, size_t index) { (*static_cast<Task*>(t))(index); };
+            task_ = &task;
+            pending_ = threads_.size();
+            generation_++;
+        }
+        start_.notify_all();
+        task(0);
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_.wait(lock, [&] { return pending_ == 0; });
+        invoke_ = nullptr;
+        task_ = nullptr;
+    }
+};
+
+instance_group::instance_group(cs_fmu& fmu, const size_t size, const size_t threads)
+{
+    members_.reserve(size);
+    for (size_t i = 0; i < size; i++) {
+        members_.push_back(fmu.new_instance());
+    }
+    const auto ranges = std::max<size_t>(1, std::min(threads, size));
+    if (ranges > 1) {
+        pool_ = std::make_unique<worker_pool>(ranges - 1);
+    }
+    scratch_.resize(ranges);
+    rangeOk_.resize(ranges);
+    rangeErrors_.resize(ranges);
+}
+
+instance_group::~instance_group() = default;
+
+template<typename Fn>
+bool instance_group::for_each_range(Fn&& fn)
+{
+    const auto ranges = scratch_.size();
+    const auto n = members_.size();
+    if (!pool_) {
+        return fn(0, 0, n);
+    }
+
+    auto task = [&](size_t range) {
+        rangeOk_[range] = false;
+        try {
+            rangeOk_[range] = fn(range, n * range / ranges, n * (range + 1) / ranges);
+        } catch (...) {
+            rangeErrors_[range] = std::current_exception();
+        }
+    };
+    pool_->run(task);
+    std::exception_ptr error;
+    for (auto& rangeError : rangeErrors_) {
+        if (!error) {
+            error = rangeError;
+        }
+        rangeError = nullptr;
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+    return std::all_of(rangeOk_.begin(), rangeOk_.end(), [](char rangeOk) { return rangeOk; });
+}
+
+bool instance_group::setup_experiment(double start, double stop, double tolerance)
+{
+    return for_each_range([&](size_t, size_t begin, size_t end) {
+        bool ok = true;
+        for (size_t i = begin; i < end; i++) {
+            ok = members_[i]->setup_experiment(start, stop, tolerance) && ok;
+        }
+        return ok;
+    });
+}
+
+bool instance_group::enter_initialization_mode()
+{
+    return for_each_range([&](size_t, size_t begin, size_t end) {
+        bool ok = true;
+        for (size_t i = begin; i < end; i++) {
+            ok = members_[i]->enter_initialization_mode() && ok;
+        }
+        return ok;
+    });
+}
+
+bool instance_group::exit_initialization_mode()
+{
+    return for_each_range([&](size_t, size_t begin, size_t end) {
+        bool ok = true;
+        for (size_t i = begin; i < end; i++) {
+            ok = members_[i]->exit_initialization_mode() && ok;
+        }
+        return ok;
+    });
+}
+
+bool instance_group::step_all(const double stepSize)
+{
+    return for_each_range([&](size_t, size_t begin, size_t end) {
+        bool ok = true;
+        for (size_t i = begin; i < end; i++) {
+            ok = members_[i]->step(stepSize) && ok;
+        }
+        return ok;
+    });
+}
+
+bool instance_group::read_all(group_matrix& matrix)
+{
+    if (matrix.instances() != members_.size()) {
+        throw std::runtime_error("The matrix does not have a column for every member of the group");
+    }
+    const auto& vrs = matrix.layout();
+    return for_each_range([&](size_t range, size_t begin, size_t end) {
+        auto& values = scratch_[range];
+        bool ok = true;
+        for (size_t i = begin; i < end; i++) {
+            auto& member = *members_[i];
+            ok = gather<base_type::integer>(matrix, vrs.integers, i, values.integers,
+                     [&](auto... args) { return member.read_integer(args...); }) && ok;
+            ok = gather<base_type::real>(matrix, vrs.reals, i, values.reals,
+                     [&](auto... args) { return member.read_real(args...); }) && ok;
+            ok = gather<base_type::boolean>(matrix, vrs.booleans, i, values.booleans,
+                     [&](auto... args) { return member.read_boolean(args...); }) && ok;
+        }
+        return ok;
+    });
+}
+
+bool instance_group::write_all(const group_matrix& matrix)
+{
+    if (matrix.instances() != members_.size()) {
+        throw std::runtime_error("The matrix does not have a column for every member of the group");
+    }
+    const auto& vrs = matrix.layout();
+    return for_each_range([&](size_t range, size_t begin, size_t end) {
+        auto& values = scratch_[range];
+        bool ok = true;
+        for (size_t i = begin; i < end; i++) {
+            auto& member = *members_[i];
+            ok = scatter<base_type::integer>(matrix, vrs.integers, i, values.integers,
+                     [&](auto... args) { return member.write_integer(args...); }) && ok;
+            ok = scatter<base_type::real>(matrix, vrs.reals, i, values.reals,
+                     [&](auto... args) { return member.write_real(args...); }) && ok;
+            ok = scatter<base_type::boolean>(matrix, vrs.booleans, i, values.booleans,
+                     [&](auto... args) { return member.write_boolean(args...); }) && ok;
+        }
+        return ok;
+    });
+}
+
+bool instance_group::terminate()
+{
+    return for_each_range([&](size_t, size_t begin, size_t end) {
+        bool ok = true;
+        for (size_t i = begin; i < end; i++) {
+            ok = members_[i]->terminate() && ok;
+        }
+        return ok;
+    });
+}
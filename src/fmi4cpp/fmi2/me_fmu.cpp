@@ -25,12 +25,12 @@ std::shared_ptr<const me_model_description> me_fmu::get_model_description() cons
 
 std::unique_ptr<me_instance> me_fmu::new_instance(const bool visible, const bool loggingOn)
 {
-    std::shared_ptr<me_library> lib = nullptr;
     auto modelIdentifier = modelDescription_->model_identifier;
     if (lib_ == nullptr) {
         lib_ = std::make_shared<me_library>(modelIdentifier, resource_);
     }
-    lib = lib_;
+    // each instance gets its own copy, sharing the loaded library but not the status
+    auto lib = std::make_shared<me_library>(*lib_);
 
     fmi2Component c = lib->instantiate(modelIdentifier, fmi2ModelExchange, guid(),
         resource_->resource_path(), visible, loggingOn);
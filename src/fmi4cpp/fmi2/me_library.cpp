@@ -10,31 +10,31 @@ me_library::me_library(const std::string& modelIdentifier,
     : fmi2_library(modelIdentifier, resource)
 {
 
-    fmi2EnterEventMode_ = load_function<fmi2EnterEventModeTYPE*>(handle_, "fmi2EnterEventMode");
-    fmi2EnterContinuousTimeMode_ = load_function<fmi2EnterContinuousTimeModeTYPE*>(
+    functions_.enter_event_mode = load_function<fmi2EnterEventModeTYPE*>(handle_, "fmi2EnterEventMode");
+    functions_.enter_continuous_time_mode = load_function<fmi2EnterContinuousTimeModeTYPE*>(
         handle_, "fmi2EnterContinuousTimeMode");
-    fmi2SetTime_ = load_function<fmi2SetTimeTYPE*>(handle_, "fmi2SetTime");
-    fmi2SetContinuousStates_ = load_function<fmi2SetContinuousStatesTYPE*>(handle_, "fmi2SetContinuousStates");
-    fmi2GetDerivatives_ = load_function<fmi2GetDerivativesTYPE*>(handle_, "fmi2GetDerivatives");
-    fmi2GetEventIndicators_ = load_function<fmi2GetEventIndicatorsTYPE*>(handle_, "fmi2GetEventIndicators");
-    fmi2GetContinuousStates_ = load_function<fmi2GetContinuousStatesTYPE*>(handle_, "fmi2GetContinuousStates");
-    fmi2GetNominalsOfContinuousStates_ = load_function<fmi2GetNominalsOfContinuousStatesTYPE*>(
+    functions_.set_time = load_function<fmi2SetTimeTYPE*>(handle_, "fmi2SetTime");
+    functions_.set_continuous_states = load_function<fmi2SetContinuousStatesTYPE*>(handle_, "fmi2SetContinuousStates");
+    functions_.get_derivatives = load_function<fmi2GetDerivativesTYPE*>(handle_, "fmi2GetDerivatives");
+    functions_.get_event_indicators = load_function<fmi2GetEventIndicatorsTYPE*>(handle_, "fmi2GetEventIndicators");
+    functions_.get_continuous_states = load_function<fmi2GetContinuousStatesTYPE*>(handle_, "fmi2GetContinuousStates");
+    functions_.get_nominals_of_continuous_states = load_function<fmi2GetNominalsOfContinuousStatesTYPE*>(
         handle_, "fmi2GetNominalsOfContinuousStates");
-    fmi2CompletedIntegratorStep_ = load_function<fmi2CompletedIntegratorStepTYPE*>(handle_,
+    functions_.completed_integrator_step = load_function<fmi2CompletedIntegratorStepTYPE*>(handle_,
         "fmi2CompletedIntegratorStep");
-    fmi2NewDiscreteStates_ = load_function<fmi2NewDiscreteStatesTYPE*>(handle_, "fmi2NewDiscreteStates");
+    functions_.new_discrete_states = load_function<fmi2NewDiscreteStatesTYPE*>(handle_, "fmi2NewDiscreteStates");
 }
 
 bool me_library::enter_event_mode(fmi2Component c)
 {
     return update_status_and_return_true_if_ok(
-        fmi2EnterEventMode_(c));
+        functions_.enter_event_mode(c));
 }
 
 bool me_library::enter_continuous_time_mode(fmi2Component c)
 {
     return update_status_and_return_true_if_ok(
-        fmi2EnterContinuousTimeMode_(c));
+        functions_.enter_continuous_time_mode(c));
 }
 
 bool me_library::set_time(
@@ -42,7 +42,7 @@ bool me_library::set_time(
     double time)
 {
     return update_status_and_return_true_if_ok(
-        fmi2SetTime_(c, time));
+        functions_.set_time(c, time));
 }
 
 bool me_library::set_continuous_states(
@@ -50,7 +50,7 @@ bool me_library::set_continuous_states(
     const std::vector<fmi2Real>& x)
 {
     return update_status_and_return_true_if_ok(
-        fmi2SetContinuousStates_(c, x.data(), x.size()));
+        functions_.set_continuous_states(c, x.data(), x.size()));
 }
 
 bool me_library::get_derivatives(
@@ -58,7 +58,7 @@ bool me_library::get_derivatives(
     std::vector<fmi2Real>& derivatives)
 {
     return update_status_and_return_true_if_ok(
-        fmi2GetDerivatives_(c, derivatives.data(), derivatives.size()));
+        functions_.get_derivatives(c, derivatives.data(), derivatives.size()));
 }
 
 bool me_library::get_event_indicators(
@@ -66,7 +66,7 @@ bool me_library::get_event_indicators(
     std::vector<fmi2Real>& eventIndicators)
 {
     return update_status_and_return_true_if_ok(
-        fmi2GetEventIndicators_(c, eventIndicators.data(), eventIndicators.size()));
+        functions_.get_event_indicators(c, eventIndicators.data(), eventIndicators.size()));
 }
 
 bool me_library::get_continuous_states(
@@ -74,7 +74,7 @@ bool me_library::get_continuous_states(
     std::vector<fmi2Real>& x)
 {
     return update_status_and_return_true_if_ok(
-        fmi2GetContinuousStates_(c, x.data(), x.size()));
+        functions_.get_continuous_states(c, x.data(), x.size()));
 }
 
 bool me_library::get_nominals_of_continuous_states(
@@ -82,7 +82,7 @@ bool me_library::get_nominals_of_continuous_states(
     std::vector<fmi2Real>& x_nominal)
 {
     return update_status_and_return_true_if_ok(
-        fmi2GetNominalsOfContinuousStates_(c, x_nominal.data(), x_nominal.size()));
+        functions_.get_nominals_of_continuous_states(c, x_nominal.data(), x_nominal.size()));
 }
 
 bool me_library::completed_integrator_step(
@@ -92,7 +92,7 @@ bool me_library::completed_integrator_step(
     fmi2Boolean& terminateSimulation)
 {
     return update_status_and_return_true_if_ok(
-        fmi2CompletedIntegratorStep_(c, noSetFMUStatePriorToCurrentPoint, &enterEventMode, &terminateSimulation));
+        functions_.completed_integrator_step(c, noSetFMUStatePriorToCurrentPoint, &enterEventMode, &terminateSimulation));
 }
 
 bool me_library::new_discrete_states(
@@ -100,5 +100,5 @@ bool me_library::new_discrete_states(
     fmi2EventInfo& eventInfo)
 {
     return update_status_and_return_true_if_ok(
-        fmi2NewDiscreteStates_(c, &eventInfo));
+        functions_.new_discrete_states(c, &eventInfo));
 }
@@ -5,49 +5,68 @@ using fmi4cpp::fmi2::causality;
 using fmi4cpp::fmi2::initial;
 using fmi4cpp::fmi2::variability;
 
-causality fmi4cpp::fmi2::parse_causality(const std::string& str)
+// The attribute values are told apart by their length, and the first character where lengths collide,
+// so each lookup costs a single switch and one comparison.
+
+causality fmi4cpp::fmi2::parse_causality(std::string_view str)
 {
-    if (str == "calculatedParameter") {
-        return causality::calculatedParameter;
-    } else if (str == "parameter") {
-        return causality::parameter;
-    } else if (str == "input") {
-        return causality::input;
-    } else if (str == "output") {
-        return causality::output;
-    } else if (str == "independent") {
-        return causality::independent;
-    } else {
-        return causality::local;
+    switch (str.size()) {
+        case 5:
+            if (str == "input") return causality::input;
+            break;
+        case 6:
+            if (str == "output") return causality::output;
+            break;
+        case 9:
+            if (str == "parameter") return causality::parameter;
+            break;
+        case 11:
+            if (str == "independent") return causality::independent;
+            break;
+        case 19:
+            if (str == "calculatedParameter") return causality::calculatedParameter;
+            break;
+        default:
+            break;
     }
+    return causality::local;
 }
 
-variability fmi4cpp::fmi2::parse_variability(const std::string& str)
+variability fmi4cpp::fmi2::parse_variability(std::string_view str)
 {
-    if (str == "constant") {
-        return variability::constant;
-    } else if (str == "fixed") {
-        return variability::fixed;
-    } else if (str == "tunable") {
-        return variability::tunable;
-    } else if (str == "discrete") {
-        return variability::discrete;
-    } else {
-        return variability::continuous;
+    switch (str.size()) {
+        case 5:
+            if (str == "fixed") return variability::fixed;
+            break;
+        case 7:
+            if (str == "tunable") return variability::tunable;
+            break;
+        case 8:
+            if (str[0] == 'c' && str == "constant") return variability::constant;
+            if (str[0] == 'd' && str == "discrete") return variability::discrete;
+            break;
+        default:
+            break;
     }
+    return variability::continuous;
 }
 
-initial fmi4cpp::fmi2::parse_initial(const std::string& str)
+initial fmi4cpp::fmi2::parse_initial(std::string_view str)
 {
-    if (str == "exact") {
-        return initial::exact;
-    } else if (str == "approx") {
-        return initial::approx;
-    } else if (str == "calculated") {
-        return initial::calculated;
-    } else {
-        return initial::unknown;
+    switch (str.size()) {
+        case 5:
+            if (str == "exact") return initial::exact;
+            break;
+        case 6:
+            if (str == "approx") return initial::approx;
+            break;
+        case 10:
+            if (str == "calculated") return initial::calculated;
+            break;
+        default:
+            break;
     }
+    return initial::unknown;
 }
 
 std::string fmi4cpp::fmi2::to_string(causality causality)
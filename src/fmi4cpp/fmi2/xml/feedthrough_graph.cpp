@@ -0,0 +1,59 @@
+
+#include <fmi4cpp/fmi2/xml/feedthrough_graph.hpp>
+
+#include <algorithm>
+#include <cstdint>
+
+using namespace fmi4cpp;
+using namespace fmi4cpp::fmi2;
+
+bool feedthrough_graph::depends_on(const size_t output, const size_t input) const
+{
+    const auto begin = input_indices.begin() + output_offsets[output];
+    const auto end = input_indices.begin() + output_offsets[output + 1];
+    return std::binary_search(begin, end, input);
+}
+
+feedthrough_graph fmi4cpp::fmi2::make_feedthrough_graph(const model_variables& variables, const model_structure& structure)
+{
+    feedthrough_graph graph;
+
+    // input position of each variable, by 1-based ModelVariables index as used in the dependencies
+    std::vector<size_t> inputOf(variables.size() + 1, SIZE_MAX);
+    for (const auto index : variables.by_causality(causality::input).indices) {
+        inputOf[index + 1] = graph.input_vrs.size();
+        graph.input_vrs.push_back(variables[index].value_reference);
+        graph.input_variables.push_back(index);
+    }
+
+    graph.output_offsets.push_back(0);
+    for (const auto& output : structure.outputs) {
+        if (output.index < 1 || output.index > variables.size()) {
+            continue;
+        }
+        graph.output_vrs.push_back(variables[output.index - 1].value_reference);
+        graph.output_variables.push_back(output.index - 1);
+        graph.full_dependency.push_back(!output.dependencies);
+
+        const auto begin = graph.input_indices.size();
+        if (!output.dependencies) {
+            for (size_t i = 0; i < graph.num_inputs(); i++) {
+                graph.input_indices.push_back(i);
+            }
+        } else {
+            // states and other knowns in the list are not inputs and carry no feedthrough
+            for (const auto dependency : *output.dependencies) {
+                if (dependency < inputOf.size() && inputOf[dependency] != SIZE_MAX) {
+                    graph.input_indices.push_back(inputOf[dependency]);
+                }
+            }
+            std::sort(graph.input_indices.begin() + begin, graph.input_indices.end());
+            graph.input_indices.erase(
+                std::unique(graph.input_indices.begin() + begin, graph.input_indices.end()),
+                graph.input_indices.end());
+        }
+        graph.output_offsets.push_back(graph.input_indices.size());
+    }
+
+    return graph;
+}
@@ -0,0 +1,146 @@
+
+#include <fmi4cpp/fmi2/xml/jacobian_sparsity.hpp>
+#include <fmi4cpp/fmi2/xml/typed_scalar_variable.hpp>
+
+#include <algorithm>
+#include <cstdint>
+
+using namespace fmi4cpp;
+using namespace fmi4cpp::fmi2;
+
+namespace
+{
+
+void colour_columns(jacobian_sparsity& sparsity)
+{
+    const auto numColumns = sparsity.columns();
+
+    // rows of every column, the transpose of the pattern
+    std::vector<std::vector<size_t>> columnRows(numColumns);
+    for (size_t r = 0; r < sparsity.rows(); r++) {
+        for (size_t k = sparsity.row_offsets[r]; k < sparsity.row_offsets[r + 1]; k++) {
+            columnRows[sparsity.column_indices[k]].push_back(r);
+        }
+    }
+
+    // greedy largest-first: densest columns pick their colour first
+    std::vector<size_t> order(numColumns);
+    for (size_t c = 0; c < numColumns; c++) {
+        order[c] = c;
+    }
+    std::stable_sort(order.begin(), order.end(), [&columnRows](size_t a, size_t b) {
+        return columnRows[a].size() > columnRows[b].size();
+    });
+
+    sparsity.colours.assign(numColumns, SIZE_MAX);
+    sparsity.num_colours = 0;
+    std::vector<size_t> forbiddenBy(numColumns, SIZE_MAX);
+    for (const auto column : order) {
+        // colours of all columns sharing a row with this one
+        for (const auto r : columnRows[column]) {
+            for (size_t k = sparsity.row_offsets[r]; k < sparsity.row_offsets[r + 1]; k++) {
+                const auto colour = sparsity.colours[sparsity.column_indices[k]];
+                if (colour != SIZE_MAX) {
+                    forbiddenBy[colour] = column;
+                }
+            }
+        }
+        size_t colour = 0;
+        while (forbiddenBy[colour] == column) {
+            colour++;
+        }
+        sparsity.colours[column] = colour;
+        sparsity.num_colours = std::max(sparsity.num_colours, colour + 1);
+    }
+}
+
+} // namespace
+
+std::vector<fmi4cppValueReference> jacobian_sparsity::seed(const size_t colour) const
+{
+    std::vector<fmi4cppValueReference> vrs;
+    for (size_t c = 0; c < columns(); c++) {
+        if (colours[c] == colour) {
+            vrs.push_back(column_vrs[c]);
+        }
+    }
+    return vrs;
+}
+
+void jacobian_sparsity::scatter(
+    const size_t colour,
+    const std::vector<fmi4cppReal>& derivatives,
+    std::vector<fmi4cppReal>& values) const
+{
+    values.resize(non_zeros());
+    for (size_t r = 0; r < rows(); r++) {
+        for (size_t k = row_offsets[r]; k < row_offsets[r + 1]; k++) {
+            if (colours[column_indices[k]] == colour) {
+                values[k] = derivatives[r];
+            }
+        }
+    }
+}
+
+jacobian_sparsity fmi4cpp::fmi2::make_jacobian_sparsity(const model_variables& variables, const model_structure& structure)
+{
+    jacobian_sparsity sparsity;
+
+    // column of each variable, by 1-based ModelVariables index as used in the dependencies
+    std::vector<size_t> columnOf(variables.size() + 1, SIZE_MAX);
+    const auto add_column = [&](size_t index) {
+        if (index >= 1 && index <= variables.size() && columnOf[index] == SIZE_MAX) {
+            columnOf[index] = sparsity.column_vrs.size();
+            sparsity.column_vrs.push_back(variables[index - 1].value_reference);
+        }
+    };
+
+    std::vector<const unknown*> rows;
+    for (const auto& derivative : structure.derivatives) {
+        if (derivative.index >= 1 && derivative.index <= variables.size()) {
+            const auto& v = variables[derivative.index - 1];
+            if (v.is_real()) {
+                if (const auto state = v.as_real().derivative()) {
+                    add_column(*state);
+                }
+            }
+            rows.push_back(&derivative);
+        }
+    }
+    for (const auto& output : structure.outputs) {
+        if (output.index >= 1 && output.index <= variables.size() && variables[output.index - 1].is_real()) {
+            rows.push_back(&output);
+        }
+    }
+    for (const auto index : variables.by_causality(causality::input).indices) {
+        if (variables[index].is_real()) {
+            add_column(index + 1);
+        }
+    }
+
+    sparsity.row_offsets.reserve(rows.size() + 1);
+    sparsity.row_offsets.push_back(0);
+    for (const auto row : rows) {
+        sparsity.row_vrs.push_back(variables[row->index - 1].value_reference);
+        const auto begin = sparsity.column_indices.size();
+        if (!row->dependencies) {
+            for (size_t c = 0; c < sparsity.columns(); c++) {
+                sparsity.column_indices.push_back(c);
+            }
+        } else {
+            for (const auto dependency : *row->dependencies) {
+                if (dependency < columnOf.size() && columnOf[dependency] != SIZE_MAX) {
+                    sparsity.column_indices.push_back(columnOf[dependency]);
+                }
+            }
+            std::sort(sparsity.column_indices.begin() + begin, sparsity.column_indices.end());
+            sparsity.column_indices.erase(
+                std::unique(sparsity.column_indices.begin() + begin, sparsity.column_indices.end()),
+                sparsity.column_indices.end());
+        }
+        sparsity.row_offsets.push_back(sparsity.column_indices.size());
+    }
+
+    colour_columns(sparsity);
+    return sparsity;
+}
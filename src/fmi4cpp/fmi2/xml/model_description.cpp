@@ -5,8 +5,26 @@
 #include <utility>
 #include <stdexcept>
 
+using namespace fmi4cpp;
 using namespace fmi4cpp::fmi2;
 
+namespace
+{
+
+base_type base_type_of(const scalar_variable& v)
+{
+    if (v.is_real()) {
+        return base_type::real;
+    } else if (v.is_boolean()) {
+        return base_type::boolean;
+    } else if (v.is_string()) {
+        return base_type::string;
+    }
+    return base_type::integer;
+}
+
+} // namespace
+
 size_t model_description_base::number_of_continuous_states() const
 {
     return model_structure->derivatives.size();
@@ -22,6 +40,54 @@ fmi2ValueReference model_description_base::get_value_reference(const std::string
     return model_variables->getByName(name).value_reference;
 }
 
+fmi2ValueReference model_description_base::get_value_reference(const std::string& name, const base_type type) const
+{
+    const auto& v = model_variables->getByName(name);
+    if (base_type_of(v) != type) {
+        throw std::runtime_error("Variable '" + name + "' is of another base type");
+    }
+    return v.value_reference;
+}
+
+value_reference_set model_description_base::select_by_prefix(const std::string& prefix) const
+{
+    return model_variables->value_references(model_variables->find_by_prefix(prefix));
+}
+
+value_reference_set model_description_base::select_by_glob(const std::string& pattern) const
+{
+    return model_variables->value_references(model_variables->find_by_glob(pattern));
+}
+
+value_reference_set model_description_base::select_by_array_index(
+    const std::string& arrayName,
+    const size_t first,
+    const size_t last) const
+{
+    return model_variables->value_references(model_variables->find_by_array_index(arrayName, first, last));
+}
+
+access_plan model_description_base::make_access_plan(const std::vector<std::string>& names) const
+{
+    std::vector<std::pair<base_type, fmi2ValueReference>> signals;
+    signals.reserve(names.size());
+    for (const auto& name : names) {
+        const auto& v = model_variables->getByName(name);
+        signals.emplace_back(base_type_of(v), v.value_reference);
+    }
+    return access_plan(signals);
+}
+
+jacobian_sparsity model_description_base::get_jacobian_sparsity() const
+{
+    return make_jacobian_sparsity(*model_variables, *model_structure);
+}
+
+feedthrough_graph model_description_base::get_feedthrough_graph() const
+{
+    return make_feedthrough_graph(*model_variables, *model_structure);
+}
+
 model_description::model_description(
     const model_description_base& base,
     std::optional<cs_attributes> coSimulation,
@@ -29,7 +95,14 @@ model_description::model_description(
     : model_description_base(base)
     , coSimulation_(std::move(coSimulation))
     , modelExchange_(std::move(modelExchange))
-{}
+{
+    if (coSimulation_) {
+        csDescription_ = std::make_shared<const cs_model_description>(*this, *coSimulation_);
+    }
+    if (modelExchange_) {
+        meDescription_ = std::make_shared<const me_model_description>(*this, *modelExchange_);
+    }
+}
 
 bool model_description::supports_cs() const
 {
@@ -41,18 +114,18 @@ bool model_description::supports_me() const
     return modelExchange_.has_value();
 }
 
-std::unique_ptr<const cs_model_description> model_description::as_cs_description() const
+std::shared_ptr<const cs_model_description> model_description::as_cs_description() const
 {
     if (!supports_cs()) {
         throw std::runtime_error("CoSimulation not supported!");
     }
-    return std::make_unique<cs_model_description>(*this, *coSimulation_);
+    return csDescription_;
 }
 
-std::unique_ptr<const me_model_description> model_description::as_me_description() const
+std::shared_ptr<const me_model_description> model_description::as_me_description() const
 {
     if (!supports_me()) {
         throw std::runtime_error("ModelExchange not supported!");
     }
-    return std::make_unique<me_model_description>(*this, *modelExchange_);
+    return meDescription_;
 }
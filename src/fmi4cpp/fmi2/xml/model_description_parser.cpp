@@ -1,55 +1,59 @@
 
 #include <fmi4cpp/fmi2/xml/model_description_parser.hpp>
+#include <fmi4cpp/fmi2/xml/parser_helper.hpp>
 #include <fmi4cpp/fmi2/xml/scalar_variable.hpp>
 
 #include <pugixml.hpp>
-#include <sstream>
+
+#include <cstring>
+#include <fstream>
 #include <stdexcept>
+#include <vector>
 
 using namespace fmi4cpp::fmi2;
+using namespace fmi4cpp::fmi2::detail;
 
 namespace
 {
 
-void split(std::vector<std::string>& store, const std::string& target, char c)
+bool has_name(const pugi::xml_node& node, const char* name)
 {
-    std::string temp;
-    std::stringstream ss{target};
-    std::vector<std::string> result;
-
-    while (std::getline(ss, temp, c)) {
-        store.push_back(temp);
-    }
+    return std::strcmp(node.name(), name) == 0;
 }
 
-
-void parse_unknown_dependencies_kind(const std::string& str, std::vector<std::string>& store)
+size_t count_children(const pugi::xml_node& node, const char* name)
 {
-    split(store, str, ' ');
+    size_t count = 0;
+    for (const pugi::xml_node& v : node.children(name)) {
+        (void)v;
+        count++;
+    }
+    return count;
 }
 
 template<typename T>
-T parse_attribute(const pugi::xml_node& node, const std::string& name)
+T parse_attribute(const pugi::xml_node& node, const char* name)
 {
     if constexpr (std::is_same_v<T, int>) {
-        return node.attribute(name.c_str()).as_int();
+        return node.attribute(name).as_int();
     } else if constexpr (std::is_same_v<T, unsigned int>) {
-        return node.attribute(name.c_str()).as_uint();
+        return node.attribute(name).as_uint();
     } else if constexpr (std::is_same_v<T, double>) {
-        return node.attribute(name.c_str()).as_double();
+        return node.attribute(name).as_double();
     } else if constexpr (std::is_same_v<T, bool>) {
-        return node.attribute(name.c_str()).as_bool();
+        return node.attribute(name).as_bool();
     } else if constexpr (std::is_same_v<T, std::string>) {
-        return node.attribute(name.c_str()).as_string();
+        return node.attribute(name).as_string();
     } else {
-        throw std::runtime_error("Unable to parse attribute: " + name);
+        throw std::runtime_error("Unable to parse attribute: " + std::string(name));
     }
 }
 
 template<typename T>
-std::optional<T> parse_optional_attribute(const pugi::xml_node& node, const std::string& name)
+std::optional<T> parse_optional_attribute(const pugi::xml_node& node, const char* name)
 {
-    if (node.attribute(name.c_str()).empty()) {
+    const auto attribute = node.attribute(name);
+    if (attribute.empty()) {
         return std::nullopt;
     }
     return parse_attribute<T>(node, name);
@@ -75,23 +79,9 @@ source_file parse_file(const pugi::xml_node& node)
 
 void parse_source_files(const pugi::xml_node& node, source_files& files)
 {
-    for (const pugi::xml_node& v : node) {
-        if (std::string("File") == v.name()) {
-            auto file = parse_file(v);
-            files.push_back(file);
-        }
-    }
-}
-
-void parse_unknown_dependencies(const std::string& str, std::vector<unsigned int>& store)
-{
-    unsigned int i;
-    std::stringstream ss(str);
-    while (ss >> i) {
-        store.push_back(i);
-        if (ss.peek() == ',' || ss.peek() == ' ') {
-            ss.ignore();
-        }
+    files.reserve(count_children(node, "File"));
+    for (const pugi::xml_node& v : node.children("File")) {
+        files.push_back(parse_file(v));
     }
 }
 
@@ -101,18 +91,18 @@ unknown parse_unknown(const pugi::xml_node& node)
     unknown unknown;
     unknown.index = node.attribute("index").as_uint();
 
-    auto optDependencies = parse_optional_attribute<std::string>(node, "dependencies");
-    if (optDependencies) {
-        std::vector<unsigned int> dependencies;
-        parse_unknown_dependencies(*optDependencies, dependencies);
-        unknown.dependencies = dependencies;
+    const auto dependencies = node.attribute("dependencies");
+    if (!dependencies.empty()) {
+        std::vector<unsigned int> store;
+        parse_unknown_dependencies(dependencies.value(), store);
+        unknown.dependencies = std::move(store);
     }
 
-    auto optDependenciesKind = parse_optional_attribute<std::string>(node, "dependenciesKind");
-    if (optDependenciesKind) {
-        std::vector<std::string> dependenciesKind;
-        parse_unknown_dependencies_kind(*optDependenciesKind, dependenciesKind);
-        unknown.dependencies_kind = dependenciesKind;
+    const auto dependenciesKind = node.attribute("dependenciesKind");
+    if (!dependenciesKind.empty()) {
+        std::vector<std::string> store;
+        parse_unknown_dependencies_kind(dependenciesKind.value(), store);
+        unknown.dependencies_kind = std::move(store);
     }
 
     return unknown;
@@ -120,11 +110,9 @@ unknown parse_unknown(const pugi::xml_node& node)
 
 void load_unknowns(const pugi::xml_node& node, std::vector<unknown>& vector)
 {
-    for (const pugi::xml_node& v : node) {
-        if (std::string("Unknown") == v.name()) {
-            auto unknown = parse_unknown(v);
-            vector.push_back(unknown);
-        }
+    vector.reserve(count_children(node, "Unknown"));
+    for (const pugi::xml_node& v : node.children("Unknown")) {
+        vector.push_back(parse_unknown(v));
     }
 }
 
@@ -136,16 +124,16 @@ std::unique_ptr<const model_structure> parse_model_structure(const pugi::xml_nod
     std::vector<unknown> initial_unknowns;
 
     for (const pugi::xml_node& v : node) {
-        if (std::string("Outputs") == v.name()) {
+        if (has_name(v, "Outputs")) {
             load_unknowns(v, outputs);
-        } else if (std::string("Derivatives") == v.name()) {
+        } else if (has_name(v, "Derivatives")) {
             load_unknowns(v, derivatives);
-        } else if (std::string("InitialUnknowns") == v.name()) {
+        } else if (has_name(v, "InitialUnknowns")) {
             load_unknowns(v, initial_unknowns);
         }
     }
 
-    return std::make_unique<const model_structure>(outputs, derivatives, initial_unknowns);
+    return std::make_unique<const model_structure>(std::move(outputs), std::move(derivatives), std::move(initial_unknowns));
 }
 
 fmu_attributes parse_fmu_attributes(const pugi::xml_node& node)
@@ -162,7 +150,7 @@ fmu_attributes parse_fmu_attributes(const pugi::xml_node& node)
     attributes.can_be_instantiated_only_once_per_process = node.attribute("canBeInstantiatedOnlyOncePerProcess").as_bool();
 
     for (const pugi::xml_node& v : node) {
-        if (std::string("SourceFiles") == v.name()) {
+        if (has_name(v, "SourceFiles")) {
             parse_source_files(v, attributes.sourceFiles);
         }
     }
@@ -187,98 +175,170 @@ me_attributes parse_me_attributes(const pugi::xml_node& node)
     return attributes;
 }
 
+std::shared_ptr<unit_definitions> parse_unit_definitions(const pugi::xml_node& node)
+{
+    std::vector<unit> units;
+    units.reserve(count_children(node, "Unit"));
+    for (const pugi::xml_node& u : node.children("Unit")) {
+        unit& unit = units.emplace_back();
+        unit.name = u.attribute("name").as_string();
+        for (const pugi::xml_node& v : u) {
+            if (has_name(v, "BaseUnit")) {
+                base_unit baseUnit;
+                baseUnit.kg = v.attribute("kg").as_int();
+                baseUnit.m = v.attribute("m").as_int();
+                baseUnit.s = v.attribute("s").as_int();
+                baseUnit.A = v.attribute("A").as_int();
+                baseUnit.K = v.attribute("K").as_int();
+                baseUnit.mol = v.attribute("mol").as_int();
+                baseUnit.cd = v.attribute("cd").as_int();
+                baseUnit.rad = v.attribute("rad").as_int();
+                baseUnit.factor = v.attribute("factor").as_double(1.0);
+                baseUnit.offset = v.attribute("offset").as_double();
+                unit.base_unit = baseUnit;
+            } else if (has_name(v, "DisplayUnit")) {
+                display_unit& displayUnit = unit.display_units.emplace_back();
+                displayUnit.name = v.attribute("name").as_string();
+                displayUnit.factor = v.attribute("factor").as_double(1.0);
+                displayUnit.offset = v.attribute("offset").as_double();
+            }
+        }
+    }
+    return std::make_shared<unit_definitions>(std::move(units));
+}
+
+std::shared_ptr<const type_definitions> parse_type_definitions(const pugi::xml_node& node, unit_definitions& units)
+{
+    std::vector<simple_type> types;
+    types.reserve(count_children(node, "SimpleType"));
+    for (const pugi::xml_node& t : node.children("SimpleType")) {
+        simple_type& type = types.emplace_back();
+        type.name = t.attribute("name").as_string();
+        type.description = parse_optional_attribute<std::string>(t, "description");
+        const auto v = t.find_child([](const pugi::xml_node& n) { return n.type() == pugi::node_element; });
+        if (!v) {
+            continue;
+        }
+        type.type_name = v.name();
+        type.quantity = parse_optional_attribute<std::string>(v, "quantity");
+        type.unit = parse_optional_attribute<std::string>(v, "unit");
+        type.display_unit = parse_optional_attribute<std::string>(v, "displayUnit");
+        type.min = parse_optional_attribute<double>(v, "min");
+        type.max = parse_optional_attribute<double>(v, "max");
+        type.nominal = parse_optional_attribute<double>(v, "nominal");
+        type.relative_quantity = v.attribute("relativeQuantity").as_bool();
+        type.unbounded = v.attribute("unbounded").as_bool();
+        for (const pugi::xml_node& i : v.children("Item")) {
+            enumeration_item& item = type.items.emplace_back();
+            item.name = i.attribute("name").as_string();
+            item.value = i.attribute("value").as_int();
+            item.description = parse_optional_attribute<std::string>(i, "description");
+        }
+        resolve_unit_ids(type, units, type.unit, type.display_unit);
+    }
+    return std::make_shared<const type_definitions>(std::move(types));
+}
+
 template<typename T>
-scalar_variable_attribute<T> parse_scalar_variable_attributes(const pugi::xml_node& node)
+scalar_variable_attribute<T> parse_scalar_variable_attributes(const pugi::xml_node& node, const type_definitions& types)
 {
     scalar_variable_attribute<T> attributes;
-    attributes.start = parse_attribute<T>(node, "start");
-    attributes.declared_type = parse_optional_attribute<std::string>(node, "declaredType");
+    attributes.start = parse_optional_attribute<T>(node, "start");
+    resolve_declared_type(attributes, parse_optional_attribute<std::string>(node, "declaredType"), types);
     return attributes;
 }
 
 template<typename T>
-bounded_scalar_variable_attribute<T> parse_bounded_scalar_variable_attributes(const pugi::xml_node& node)
+bounded_scalar_variable_attribute<T> parse_bounded_scalar_variable_attributes(const pugi::xml_node& node, const type_definitions& types)
 {
-    bounded_scalar_variable_attribute<T> attributes(parse_scalar_variable_attributes<T>(node));
+    bounded_scalar_variable_attribute<T> attributes(parse_scalar_variable_attributes<T>(node, types));
     attributes.min = parse_optional_attribute<T>(node, "min");
     attributes.max = parse_optional_attribute<T>(node, "max");
     attributes.quantity = parse_optional_attribute<std::string>(node, "quantity");
     return attributes;
 }
 
-integer_attribute parse_integer_attribute(const pugi::xml_node& node)
+integer_attribute parse_integer_attribute(const pugi::xml_node& node, const type_definitions& types)
 {
-    return integer_attribute(parse_bounded_scalar_variable_attributes<int>(node));
+    return integer_attribute(parse_bounded_scalar_variable_attributes<int>(node, types));
 }
 
-real_attribute parse_real_attribute(const pugi::xml_node& node)
+real_attribute parse_real_attribute(const pugi::xml_node& node, unit_definitions& units, const type_definitions& types)
 {
-    real_attribute attributes(parse_bounded_scalar_variable_attributes<double>(node));
+    real_attribute attributes(parse_bounded_scalar_variable_attributes<double>(node, types));
     attributes.nominal = parse_optional_attribute<double>(node, "nominal");
-    attributes.unit = parse_optional_attribute<std::string>(node, "unit");
     attributes.derivative = parse_optional_attribute<unsigned int>(node, "derivative");
     attributes.reinit = node.attribute("reinit").as_bool();
-    attributes.unbounded = node.attribute("<unbounded").as_bool();
+    attributes.unbounded = node.attribute("unbounded").as_bool();
     attributes.relative_quantity = node.attribute("relativeQuantity").as_bool();
+    resolve_units(attributes, parse_optional_attribute<std::string>(node, "unit"),
+        parse_optional_attribute<std::string>(node, "displayUnit"), units, types);
     return attributes;
 }
 
-string_attribute parse_string_attribute(const pugi::xml_node& node)
+string_attribute parse_string_attribute(const pugi::xml_node& node, const type_definitions& types)
 {
-    return string_attribute(parse_scalar_variable_attributes<std::string>(node));
+    return string_attribute(parse_scalar_variable_attributes<std::string>(node, types));
 }
 
-boolean_attribute parse_boolean_attribute(const pugi::xml_node& node)
+boolean_attribute parse_boolean_attribute(const pugi::xml_node& node, const type_definitions& types)
 {
-    return boolean_attribute(parse_scalar_variable_attributes<bool>(node));
+    return boolean_attribute(parse_scalar_variable_attributes<bool>(node, types));
 }
 
-enumeration_attribute parseEnumerationAttribute(const pugi::xml_node& node)
+enumeration_attribute parseEnumerationAttribute(const pugi::xml_node& node, const type_definitions& types)
 {
-    return enumeration_attribute(parse_bounded_scalar_variable_attributes<int>(node));
+    return enumeration_attribute(parse_bounded_scalar_variable_attributes<int>(node, types));
 }
 
 
-scalar_variable parse_scalar_variable(const pugi::xml_node& node)
+scalar_variable parse_scalar_variable(
+    const pugi::xml_node& node,
+    const std::shared_ptr<unit_definitions>& units,
+    const std::shared_ptr<const type_definitions>& types)
 {
     scalar_variable_base base;
+    base.unit_definitions = units;
+    base.type_definitions = types;
 
     base.name = node.attribute("name").as_string();
     base.description = node.attribute("description").as_string();
     base.value_reference = node.attribute("valueReference").as_uint();
     base.can_handle_multiple_set_per_time_instant = node.attribute("canHandleMultipleSetPerTimelnstant").as_bool();
 
-    base.causality = parse_causality(node.attribute("causality").as_string());
-    base.variability = parse_variability(node.attribute("variability").as_string());
-    base.initial = parse_initial(node.attribute("initial").as_string());
+    base.causality = parse_causality(node.attribute("causality").value());
+    base.variability = parse_variability(node.attribute("variability").value());
+    base.initial = parse_initial(node.attribute("initial").value());
 
     for (const pugi::xml_node& v : node) {
-        if (INTEGER_TYPE == v.name()) {
-            return {base, parse_integer_attribute(v)};
-        } else if (REAL_TYPE == v.name()) {
-            return {base, parse_real_attribute(v)};
-        } else if (STRING_TYPE == v.name()) {
-            return {base, parse_string_attribute(v)};
-        } else if (BOOLEAN_TYPE == v.name()) {
-            return {base, parse_boolean_attribute(v)};
-        } else if (ENUMERATION_TYPE == v.name()) {
-            return {base, parseEnumerationAttribute(v)};
+        if (has_name(v, "Integer")) {
+            return {base, parse_integer_attribute(v, *types)};
+        } else if (has_name(v, "Real")) {
+            return {base, parse_real_attribute(v, *units, *types)};
+        } else if (has_name(v, "String")) {
+            return {base, parse_string_attribute(v, *types)};
+        } else if (has_name(v, "Boolean")) {
+            return {base, parse_boolean_attribute(v, *types)};
+        } else if (has_name(v, "Enumeration")) {
+            return {base, parseEnumerationAttribute(v, *types)};
         }
     }
 
     throw std::runtime_error("FATAL: Failed to parse ScalarVariable!");
 }
 
-std::unique_ptr<const model_variables> parse_model_variables(const pugi::xml_node& node)
+std::unique_ptr<const model_variables> parse_model_variables(
+    const pugi::xml_node& node,
+    const std::shared_ptr<unit_definitions>& units,
+    const std::shared_ptr<const type_definitions>& types,
+    const std::vector<unknown>& derivatives)
 {
     std::vector<scalar_variable> variables;
-    for (const pugi::xml_node& v : node) {
-        if (std::string("ScalarVariable") == v.name()) {
-            auto var = parse_scalar_variable(v);
-            variables.push_back(var);
-        }
+    variables.reserve(count_children(node, "ScalarVariable"));
+    for (const pugi::xml_node& v : node.children("ScalarVariable")) {
+        variables.push_back(parse_scalar_variable(v, units, types));
     }
-    return std::make_unique<const model_variables>(variables);
+    return std::make_unique<const model_variables>(std::move(variables), derivatives);
 }
 
 } // namespace
@@ -286,8 +346,24 @@ std::unique_ptr<const model_variables> parse_model_variables(const pugi::xml_nod
 std::unique_ptr<const model_description> fmi4cpp::fmi2::parse_model_description(const std::string& fileName)
 {
 
+    std::ifstream file(fileName, std::ios::binary | std::ios::ate);
+    if (!file) {
+        throw std::runtime_error("Unable to parse modelDescription.xml");
+    }
+    // parsed in place, so the document refers into this buffer instead of copying every name and value
+    const auto size = file.tellg();
+    if (size < 0) {
+        throw std::runtime_error("Unable to parse modelDescription.xml");
+    }
+    std::vector<char> buffer(static_cast<size_t>(size));
+    file.seekg(0);
+    if (!file.read(buffer.data(), size)) {
+        throw std::runtime_error("Unable to parse modelDescription.xml");
+    }
+
     pugi::xml_document doc;
-    pugi::xml_parse_result result = doc.load_file(fileName.c_str());
+    pugi::xml_parse_result result = doc.load_buffer_inplace(
+        buffer.data(), buffer.size(), pugi::parse_minimal | pugi::parse_escapes | pugi::parse_eol | pugi::parse_wconv_attribute);
     if (!result) {
         throw std::runtime_error("Unable to parse modelDescription.xml");
     }
@@ -310,20 +386,35 @@ std::unique_ptr<const model_description> fmi4cpp::fmi2::parse_model_description(
 
     std::optional<cs_attributes> coSimulation;
     std::optional<me_attributes> modelExchange;
+    // parsed once ModelStructure, which comes after it, is known
+    pugi::xml_node modelVariables;
+    // units used by variables but not defined are added while parsing them
+    auto units = std::make_shared<unit_definitions>();
 
     for (const auto& v : root) {
-        if (std::string("CoSimulation") == v.name()) {
+        if (has_name(v, "CoSimulation")) {
             coSimulation = parse_cs_attributes(v);
-        } else if (std::string("ModelExchange") == v.name()) {
+        } else if (has_name(v, "ModelExchange")) {
             modelExchange = parse_me_attributes(v);
-        } else if (std::string("DefaultExperiment") == v.name()) {
+        } else if (has_name(v, "DefaultExperiment")) {
             base.default_experiment = parse_default_experiment(v);
-        } else if (std::string("ModelVariables") == v.name()) {
-            base.model_variables = std::move(parse_model_variables(v));
-        } else if (std::string("ModelStructure") == v.name()) {
+        } else if (has_name(v, "UnitDefinitions")) {
+            units = parse_unit_definitions(v);
+        } else if (has_name(v, "TypeDefinitions")) {
+            base.type_definitions = parse_type_definitions(v, *units);
+        } else if (has_name(v, "ModelVariables")) {
+            modelVariables = v;
+        } else if (has_name(v, "ModelStructure")) {
             base.model_structure = std::move(parse_model_structure(v));
         }
     }
 
+    if (modelVariables) {
+        const std::vector<unknown> noDerivatives;
+        base.model_variables = std::move(parse_model_variables(modelVariables, units, base.type_definitions,
+            base.model_structure ? base.model_structure->derivatives : noDerivatives));
+    }
+    base.unit_definitions = units;
+
     return std::make_unique<const model_description>(base, coSimulation, modelExchange);
 }
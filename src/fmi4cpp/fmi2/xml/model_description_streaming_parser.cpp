@@ -0,0 +1,401 @@
+
+#include <fmi4cpp/fmi2/xml/model_description_parser.hpp>
+#include <fmi4cpp/fmi2/xml/parser_helper.hpp>
+#include <fmi4cpp/fmi2/xml/scalar_variable.hpp>
+#include <fmi4cpp/fmi2/xml/xml_stream_reader.hpp>
+
+#include <cstdlib>
+#include <fstream>
+#include <stdexcept>
+#include <string_view>
+
+using namespace fmi4cpp::fmi2;
+using namespace fmi4cpp::fmi2::detail;
+
+namespace
+{
+
+// Value conversions below follow the ones of pugi::xml_attribute,
+// so both parsers produce the same model description.
+
+const char* skip_spaces(const char* value)
+{
+    while (*value == ' ' || *value == '\t' || *value == '\n' || *value == '\r') {
+        value++;
+    }
+    return value;
+}
+
+long long to_integer(const char* value)
+{
+    value = skip_spaces(value);
+    const bool negative = *value == '-';
+    const char* digits = (*value == '-' || *value == '+') ? value + 1 : value;
+    if (digits[0] == '0' && (digits[1] == 'x' || digits[1] == 'X')) {
+        const auto result = static_cast<long long>(std::strtoull(digits + 2, nullptr, 16));
+        return negative ? -result : result;
+    }
+    return std::strtoll(value, nullptr, 10);
+}
+
+template<typename T>
+T parse_value(const char* value)
+{
+    if constexpr (std::is_same_v<T, int>) {
+        return value ? static_cast<int>(to_integer(value)) : 0;
+    } else if constexpr (std::is_same_v<T, unsigned int>) {
+        return value ? static_cast<unsigned int>(to_integer(value)) : 0;
+    } else if constexpr (std::is_same_v<T, unsigned long long>) {
+        return value ? static_cast<unsigned long long>(to_integer(value)) : 0;
+    } else if constexpr (std::is_same_v<T, double>) {
+        return value ? std::strtod(value, nullptr) : 0.0;
+    } else if constexpr (std::is_same_v<T, bool>) {
+        if (!value) return false;
+        const char c = *skip_spaces(value);
+        return c == '1' || c == 't' || c == 'T' || c == 'y' || c == 'Y';
+    } else if constexpr (std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>) {
+        return value ? value : "";
+    }
+}
+
+template<typename T>
+T parse_attribute(const xml_stream_reader& reader, const char* name)
+{
+    return parse_value<T>(reader.attribute(name));
+}
+
+template<typename T>
+std::optional<T> parse_optional_attribute(const xml_stream_reader& reader, const char* name)
+{
+    const char* value = reader.attribute(name);
+    if (!value) {
+        return std::nullopt;
+    }
+    return parse_value<T>(value);
+}
+
+default_experiment parse_default_experiment(const xml_stream_reader& reader)
+{
+    default_experiment ex;
+    ex.startTime = parse_optional_attribute<double>(reader, "startTime");
+    ex.stopTime = parse_optional_attribute<double>(reader, "stopTime");
+    ex.stepSize = parse_optional_attribute<double>(reader, "stepSize");
+    ex.tolerance = parse_optional_attribute<double>(reader, "tolerance");
+    return ex;
+}
+
+unknown parse_unknown(const xml_stream_reader& reader)
+{
+    unknown unknown;
+    unknown.index = parse_attribute<unsigned int>(reader, "index");
+
+    if (const char* dependencies = reader.attribute("dependencies")) {
+        std::vector<unsigned int> store;
+        parse_unknown_dependencies(dependencies, store);
+        unknown.dependencies = store;
+    }
+
+    if (const char* dependenciesKind = reader.attribute("dependenciesKind")) {
+        std::vector<std::string> store;
+        parse_unknown_dependencies_kind(dependenciesKind, store);
+        unknown.dependencies_kind = store;
+    }
+
+    return unknown;
+}
+
+fmu_attributes parse_fmu_attributes(const xml_stream_reader& reader)
+{
+    fmu_attributes attributes;
+    attributes.model_identifier = parse_attribute<std::string>(reader, "modelIdentifier");
+    attributes.needs_execution_tool = parse_attribute<bool>(reader, "needsExecutionTool");
+    attributes.can_get_and_set_fmu_state = parse_attribute<bool>(reader, "canGetAndSetFMUstate");
+    attributes.can_serialize_fmu_state = parse_attribute<bool>(reader, "canSerializeFMUstate");
+    attributes.provides_directional_derivative = parse_attribute<bool>(reader, "providesDirectionalDerivative");
+    attributes.can_not_use_memory_management_functions = parse_attribute<bool>(reader, "canNotUseMemoryManagementFunctions");
+    attributes.can_be_instantiated_only_once_per_process = parse_attribute<bool>(reader, "canBeInstantiatedOnlyOncePerProcess");
+    return attributes;
+}
+
+cs_attributes parse_cs_attributes(const xml_stream_reader& reader)
+{
+    cs_attributes attributes(parse_fmu_attributes(reader));
+    attributes.max_output_derivative_order = parse_attribute<unsigned int>(reader, "maxOutputDerivativeOrder");
+    attributes.can_interpolate_inputs = parse_attribute<bool>(reader, "canInterpolateInputs");
+    attributes.can_run_asynchronuously = parse_attribute<bool>(reader, "canRunAsynchronuously");
+    attributes.can_handle_variable_communication_step_size = parse_attribute<bool>(reader, "canHandleVariableCommunicationStepSize");
+    return attributes;
+}
+
+me_attributes parse_me_attributes(const xml_stream_reader& reader)
+{
+    me_attributes attributes(parse_fmu_attributes(reader));
+    attributes.completed_integrator_step_not_needed = parse_attribute<bool>(reader, "completedIntegratorStepNotNeeded");
+    return attributes;
+}
+
+base_unit parse_base_unit(const xml_stream_reader& reader)
+{
+    base_unit baseUnit;
+    baseUnit.kg = parse_attribute<int>(reader, "kg");
+    baseUnit.m = parse_attribute<int>(reader, "m");
+    baseUnit.s = parse_attribute<int>(reader, "s");
+    baseUnit.A = parse_attribute<int>(reader, "A");
+    baseUnit.K = parse_attribute<int>(reader, "K");
+    baseUnit.mol = parse_attribute<int>(reader, "mol");
+    baseUnit.cd = parse_attribute<int>(reader, "cd");
+    baseUnit.rad = parse_attribute<int>(reader, "rad");
+    baseUnit.factor = parse_optional_attribute<double>(reader, "factor").value_or(1.0);
+    baseUnit.offset = parse_attribute<double>(reader, "offset");
+    return baseUnit;
+}
+
+display_unit parse_display_unit(const xml_stream_reader& reader)
+{
+    display_unit displayUnit;
+    displayUnit.name = parse_attribute<std::string>(reader, "name");
+    displayUnit.factor = parse_optional_attribute<double>(reader, "factor").value_or(1.0);
+    displayUnit.offset = parse_attribute<double>(reader, "offset");
+    return displayUnit;
+}
+
+void parse_simple_type_attributes(const xml_stream_reader& reader, simple_type& type)
+{
+    type.type_name = reader.name();
+    type.quantity = parse_optional_attribute<std::string>(reader, "quantity");
+    type.unit = parse_optional_attribute<std::string>(reader, "unit");
+    type.display_unit = parse_optional_attribute<std::string>(reader, "displayUnit");
+    type.min = parse_optional_attribute<double>(reader, "min");
+    type.max = parse_optional_attribute<double>(reader, "max");
+    type.nominal = parse_optional_attribute<double>(reader, "nominal");
+    type.relative_quantity = parse_attribute<bool>(reader, "relativeQuantity");
+    type.unbounded = parse_attribute<bool>(reader, "unbounded");
+}
+
+enumeration_item parse_enumeration_item(const xml_stream_reader& reader)
+{
+    enumeration_item item;
+    item.name = parse_attribute<std::string>(reader, "name");
+    item.value = parse_attribute<int>(reader, "value");
+    item.description = parse_optional_attribute<std::string>(reader, "description");
+    return item;
+}
+
+template<typename T>
+scalar_variable_attribute<T> parse_scalar_variable_attributes(const xml_stream_reader& reader, const type_definitions& types)
+{
+    scalar_variable_attribute<T> attributes;
+    attributes.start = parse_optional_attribute<T>(reader, "start");
+    resolve_declared_type(attributes, parse_optional_attribute<std::string>(reader, "declaredType"), types);
+    return attributes;
+}
+
+template<typename T>
+bounded_scalar_variable_attribute<T> parse_bounded_scalar_variable_attributes(const xml_stream_reader& reader, const type_definitions& types)
+{
+    bounded_scalar_variable_attribute<T> attributes(parse_scalar_variable_attributes<T>(reader, types));
+    attributes.min = parse_optional_attribute<T>(reader, "min");
+    attributes.max = parse_optional_attribute<T>(reader, "max");
+    attributes.quantity = parse_optional_attribute<std::string>(reader, "quantity");
+    return attributes;
+}
+
+real_attribute parse_real_attribute(const xml_stream_reader& reader, unit_definitions& units, const type_definitions& types)
+{
+    real_attribute attributes(parse_bounded_scalar_variable_attributes<double>(reader, types));
+    attributes.nominal = parse_optional_attribute<double>(reader, "nominal");
+    attributes.derivative = parse_optional_attribute<unsigned int>(reader, "derivative");
+    attributes.reinit = parse_attribute<bool>(reader, "reinit");
+    attributes.unbounded = parse_attribute<bool>(reader, "unbounded");
+    attributes.relative_quantity = parse_attribute<bool>(reader, "relativeQuantity");
+    resolve_units(attributes, parse_optional_attribute<std::string>(reader, "unit"),
+        parse_optional_attribute<std::string>(reader, "displayUnit"), units, types);
+    return attributes;
+}
+
+scalar_variable_base parse_scalar_variable_base(const xml_stream_reader& reader)
+{
+    scalar_variable_base base;
+    base.name = parse_attribute<std::string>(reader, "name");
+    base.description = parse_attribute<std::string>(reader, "description");
+    base.value_reference = parse_attribute<unsigned int>(reader, "valueReference");
+    base.can_handle_multiple_set_per_time_instant = parse_attribute<bool>(reader, "canHandleMultipleSetPerTimelnstant");
+
+    base.causality = parse_causality(parse_attribute<std::string_view>(reader, "causality"));
+    base.variability = parse_variability(parse_attribute<std::string_view>(reader, "variability"));
+    base.initial = parse_initial(parse_attribute<std::string_view>(reader, "initial"));
+    return base;
+}
+
+model_description_base parse_model_description_base(const xml_stream_reader& reader)
+{
+    model_description_base base;
+    base.guid = parse_attribute<std::string>(reader, "guid");
+    base.fmi_version = parse_attribute<std::string>(reader, "fmiVersion");
+    base.model_name = parse_attribute<std::string>(reader, "modelName");
+    base.description = parse_attribute<std::string>(reader, "description");
+    base.author = parse_attribute<std::string>(reader, "author");
+    base.version = parse_attribute<std::string>(reader, "version");
+    base.license = parse_attribute<std::string>(reader, "license");
+    base.copyright = parse_attribute<std::string>(reader, "copyright");
+    base.generation_tool = parse_attribute<std::string>(reader, "generationTool");
+    base.generation_date_and_time = parse_attribute<std::string>(reader, "generationDateAndTime");
+    base.number_of_event_indicators = parse_attribute<unsigned long long>(reader, "numberOfEventIndicators");
+    const char* namingConvention = reader.attribute("variableNamingConvention");
+    base.variable_naming_convention = namingConvention ? namingConvention : "flat";
+    return base;
+}
+
+} // namespace
+
+std::unique_ptr<const model_description> fmi4cpp::fmi2::parse_model_description_streaming(const std::string& fileName)
+{
+    std::ifstream file(fileName, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("Unable to parse modelDescription.xml");
+    }
+    xml_stream_reader reader(file);
+
+    model_description_base base;
+    std::optional<cs_attributes> coSimulation;
+    std::optional<me_attributes> modelExchange;
+
+    std::vector<unit> units;
+    std::vector<simple_type> types;
+    // units used by variables or types but not defined are added to the table while parsing them
+    auto unitDefinitions = std::make_shared<unit_definitions>();
+    std::vector<scalar_variable> variables;
+    std::vector<unknown> outputs;
+    std::vector<unknown> derivatives;
+    std::vector<unknown> initialUnknowns;
+
+    bool hasRoot = false;
+    bool hasModelVariables = false;
+    bool hasModelStructure = false;
+
+    // names of the currently open elements, from the root down
+    std::vector<std::string> path;
+    std::optional<scalar_variable_base> variable;
+    fmu_attributes* attributes = nullptr;
+    std::vector<unknown>* unknowns = nullptr;
+
+    const auto parent_is = [&path](const char* name) {
+        return path.size() >= 2 && path[path.size() - 2] == name;
+    };
+
+    while (reader.next()) {
+        const auto& name = reader.name();
+
+        if (!reader.is_start()) {
+            if (path.empty() || path.back() != name) {
+                throw std::runtime_error("Unable to parse modelDescription.xml: unexpected closing tag '" + name + "'");
+            }
+            if (name == "ScalarVariable" && variable) {
+                throw std::runtime_error("FATAL: Failed to parse ScalarVariable!");
+            }
+            // the tables are complete once their element closes, which is before any variable refers to them
+            if (path.size() == 2 && name == "UnitDefinitions") {
+                unitDefinitions = std::make_shared<unit_definitions>(std::move(units));
+            } else if (path.size() == 2 && name == "TypeDefinitions") {
+                for (auto& type : types) {
+                    resolve_unit_ids(type, *unitDefinitions, type.unit, type.display_unit);
+                }
+                base.type_definitions = std::make_shared<const type_definitions>(std::move(types));
+            }
+            path.pop_back();
+            continue;
+        }
+
+        path.push_back(name);
+
+        if (path.size() == 1) {
+            if (hasRoot) {
+                throw std::runtime_error("Unable to parse modelDescription.xml");
+            }
+            hasRoot = true;
+            if (name == "fmiModelDescription") {
+                base = parse_model_description_base(reader);
+            }
+        } else if (path.size() == 2) {
+            if (name == "CoSimulation") {
+                coSimulation = parse_cs_attributes(reader);
+                attributes = &*coSimulation;
+            } else if (name == "ModelExchange") {
+                modelExchange = parse_me_attributes(reader);
+                attributes = &*modelExchange;
+            } else if (name == "DefaultExperiment") {
+                base.default_experiment = parse_default_experiment(reader);
+            } else if (name == "ModelVariables") {
+                hasModelVariables = true;
+            } else if (name == "ModelStructure") {
+                hasModelStructure = true;
+            }
+        } else if (name == "Unit" && parent_is("UnitDefinitions") && path.size() == 3) {
+            units.push_back({parse_attribute<std::string>(reader, "name"), std::nullopt, {}});
+        } else if (!units.empty() && parent_is("Unit") && path.size() == 4) {
+            if (name == "BaseUnit") {
+                units.back().base_unit = parse_base_unit(reader);
+            } else if (name == "DisplayUnit") {
+                units.back().display_units.push_back(parse_display_unit(reader));
+            }
+        } else if (name == "SimpleType" && parent_is("TypeDefinitions") && path.size() == 3) {
+            simple_type& type = types.emplace_back();
+            type.name = parse_attribute<std::string>(reader, "name");
+            type.description = parse_optional_attribute<std::string>(reader, "description");
+        } else if (!types.empty() && parent_is("SimpleType") && path.size() == 4) {
+            if (types.back().type_name.empty()) {
+                parse_simple_type_attributes(reader, types.back());
+            }
+        } else if (!types.empty() && name == "Item" && path.size() == 5 && path[1] == "TypeDefinitions") {
+            types.back().items.push_back(parse_enumeration_item(reader));
+        } else if (name == "ScalarVariable" && parent_is("ModelVariables") && path.size() == 3) {
+            variable = parse_scalar_variable_base(reader);
+            variable->unit_definitions = unitDefinitions;
+            variable->type_definitions = base.type_definitions;
+        } else if (variable && parent_is("ScalarVariable") && path.size() == 4) {
+            const auto& typeDefinitions = *base.type_definitions;
+            if (name == INTEGER_TYPE) {
+                variables.emplace_back(*variable, integer_attribute(parse_bounded_scalar_variable_attributes<int>(reader, typeDefinitions)));
+            } else if (name == REAL_TYPE) {
+                variables.emplace_back(*variable, parse_real_attribute(reader, *unitDefinitions, typeDefinitions));
+            } else if (name == STRING_TYPE) {
+                variables.emplace_back(*variable, string_attribute(parse_scalar_variable_attributes<std::string>(reader, typeDefinitions)));
+            } else if (name == BOOLEAN_TYPE) {
+                variables.emplace_back(*variable, boolean_attribute(parse_scalar_variable_attributes<bool>(reader, typeDefinitions)));
+            } else if (name == ENUMERATION_TYPE) {
+                variables.emplace_back(*variable, enumeration_attribute(parse_bounded_scalar_variable_attributes<int>(reader, typeDefinitions)));
+            } else {
+                continue;
+            }
+            variable.reset();
+        } else if (path.size() == 3 && path[1] == "ModelStructure") {
+            if (name == "Outputs") {
+                unknowns = &outputs;
+            } else if (name == "Derivatives") {
+                unknowns = &derivatives;
+            } else if (name == "InitialUnknowns") {
+                unknowns = &initialUnknowns;
+            } else {
+                unknowns = nullptr;
+            }
+        } else if (unknowns && name == "Unknown" && path.size() == 4 && path[1] == "ModelStructure") {
+            unknowns->push_back(parse_unknown(reader));
+        } else if (attributes && name == "File" && parent_is("SourceFiles") && path.size() == 4) {
+            attributes->sourceFiles.push_back({parse_attribute<std::string>(reader, "name")});
+        }
+    }
+
+    if (!hasRoot || !path.empty()) {
+        throw std::runtime_error("Unable to parse modelDescription.xml");
+    }
+
+    base.unit_definitions = unitDefinitions;
+    if (hasModelVariables) {
+        base.model_variables = std::make_shared<const model_variables>(std::move(variables), derivatives);
+    }
+    if (hasModelStructure) {
+        base.model_structure = std::make_shared<const model_structure>(std::move(outputs), std::move(derivatives), std::move(initialUnknowns));
+    }
+
+    return std::make_unique<const model_description>(base, coSimulation, modelExchange);
+}
@@ -1,34 +1,224 @@
 
 #include <fmi4cpp/fmi2/xml/enums.hpp>
 #include <fmi4cpp/fmi2/xml/model_variables.hpp>
+#include <fmi4cpp/fmi2/xml/typed_scalar_variable.hpp>
 
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
 #include <stdexcept>
 #include <utility>
 
+using namespace fmi4cpp;
 using namespace fmi4cpp::fmi2;
 
+namespace
+{
+
+bool glob_match(const std::string& str, size_t s, const std::string& pattern, size_t p)
+{
+    size_t starP = std::string::npos;
+    size_t starS = 0;
+    while (s < str.size()) {
+        if (p < pattern.size() && (pattern[p] == '?' || pattern[p] == str[s])) {
+            s++;
+            p++;
+        } else if (p < pattern.size() && pattern[p] == '*') {
+            starP = p++;
+            starS = s;
+        } else if (starP != std::string::npos) {
+            p = starP + 1;
+            s = ++starS;
+        } else {
+            return false;
+        }
+    }
+    while (p < pattern.size() && pattern[p] == '*') {
+        p++;
+    }
+    return p == pattern.size();
+}
+
+// the base type used to access a variable, as in value_reference_set
+enum class access_type
+{
+    integer,
+    real,
+    boolean,
+    string
+};
+
+access_type access_type_of(const scalar_variable& v)
+{
+    if (v.is_real()) {
+        return access_type::real;
+    } else if (v.is_boolean()) {
+        return access_type::boolean;
+    } else if (v.is_string()) {
+        return access_type::string;
+    }
+    return access_type::integer;
+}
+
+void add_value_reference(value_reference_set& set, const scalar_variable& v)
+{
+    if (v.is_real()) {
+        set.reals.push_back(v.value_reference);
+    } else if (v.is_integer() || v.is_enumeration()) {
+        set.integers.push_back(v.value_reference);
+    } else if (v.is_boolean()) {
+        set.booleans.push_back(v.value_reference);
+    } else if (v.is_string()) {
+        set.strings.push_back(v.value_reference);
+    }
+}
+
+bool add_start_value(parameter_set& set, const scalar_variable& v)
+{
+    if (v.is_real()) {
+        if (const auto start = v.as_real().start()) {
+            set.add_real(v.value_reference, *start);
+            return true;
+        }
+    } else if (v.is_integer()) {
+        if (const auto start = v.as_integer().start()) {
+            set.add_integer(v.value_reference, *start);
+            return true;
+        }
+    } else if (v.is_enumeration()) {
+        if (const auto start = v.as_enumeration().start()) {
+            set.add_integer(v.value_reference, *start);
+            return true;
+        }
+    } else if (v.is_boolean()) {
+        if (const auto start = v.as_boolean().start()) {
+            set.add_boolean(v.value_reference, *start);
+            return true;
+        }
+    } else if (v.is_string()) {
+        if (auto start = v.as_string().start()) {
+            set.add_string(v.value_reference, std::move(*start));
+            return true;
+        }
+    }
+    return false;
+}
+
+void add_to_partition(variable_partition& partition, size_t index, const scalar_variable& v)
+{
+    partition.indices.push_back(index);
+    add_value_reference(partition.value_references, v);
+}
+
+} // namespace
+
 model_variables::model_variables() = default;
 
-model_variables::model_variables(std::vector<scalar_variable> variables)
+model_variables::model_variables(std::vector<scalar_variable> variables, const std::vector<unknown>& derivatives)
     : variables_(std::move(variables))
-{}
+{
+    nameOrder_.resize(variables_.size());
+    for (size_t i = 0; i < nameOrder_.size(); i++) {
+        nameOrder_[i] = i;
+    }
+    std::stable_sort(nameOrder_.begin(), nameOrder_.end(), [this](size_t a, size_t b) {
+        return variables_[a].name < variables_[b].name;
+    });
+
+    for (size_t i = 0; i < variables_.size(); i++) {
+        const auto& v = variables_[i];
+        add_to_partition(causalities_[static_cast<size_t>(v.causality)], i, v);
+        add_to_partition(variabilities_[static_cast<size_t>(v.variability)], i, v);
+    }
+
+    // both the unknown index and the derivative attribute of the variable it points to are 1-based
+    for (const auto& derivative : derivatives) {
+        if (derivative.index < 1 || derivative.index > variables_.size()) {
+            continue;
+        }
+        const auto& v = variables_[derivative.index - 1];
+        const auto state = v.is_real() ? v.as_real().derivative() : std::nullopt;
+        if (state && *state >= 1 && *state <= variables_.size()) {
+            add_to_partition(derivatives_, derivative.index - 1, v);
+            add_to_partition(states_, *state - 1, variables_[*state - 1]);
+        }
+    }
+
+    vrOrder_.resize(variables_.size());
+    for (size_t i = 0; i < vrOrder_.size(); i++) {
+        vrOrder_[i] = i;
+    }
+    std::stable_sort(vrOrder_.begin(), vrOrder_.end(), [this](size_t a, size_t b) {
+        const auto& va = variables_[a];
+        const auto& vb = variables_[b];
+        if (va.value_reference != vb.value_reference) {
+            return va.value_reference < vb.value_reference;
+        }
+        return access_type_of(va) < access_type_of(vb);
+    });
+
+    aliasGroupOf_.resize(variables_.size());
+    for (size_t i = 0; i < vrOrder_.size(); i++) {
+        const auto& v = variables_[vrOrder_[i]];
+        if (i == 0 || v.value_reference != variables_[vrOrder_[i - 1]].value_reference ||
+            access_type_of(v) != access_type_of(variables_[vrOrder_[i - 1]])) {
+            aliasGroups_.emplace_back();
+        }
+        aliasGroups_.back().push_back(vrOrder_[i]);
+        aliasGroupOf_[vrOrder_[i]] = aliasGroups_.size() - 1;
+    }
+
+    std::vector<bool> hasStartValue(aliasGroups_.size());
+    for (size_t i = 0; i < variables_.size(); i++) {
+        const auto& v = variables_[i];
+        if (v.variability == variability::constant || v.causality == causality::independent ||
+            v.causality == causality::calculatedParameter || v.initial == initial::calculated ||
+            hasStartValue[aliasGroupOf_[i]]) {
+            continue;
+        }
+        hasStartValue[aliasGroupOf_[i]] = add_start_value(startValues_, v);
+    }
+}
+
+std::vector<size_t>::const_iterator model_variables::vr_lower_bound(const fmi2ValueReference vr) const
+{
+    return std::lower_bound(vrOrder_.begin(), vrOrder_.end(), vr, [this](size_t i, fmi2ValueReference value) {
+        return variables_[i].value_reference < value;
+    });
+}
+
+std::pair<size_t, size_t> model_variables::prefix_range(const std::string& prefix) const
+{
+    const auto first = std::lower_bound(nameOrder_.begin(), nameOrder_.end(), prefix, [this](size_t i, const std::string& p) {
+        return variables_[i].name < p;
+    });
+    auto last = first;
+    while (last != nameOrder_.end() && variables_[*last].name.compare(0, prefix.size(), prefix) == 0) {
+        ++last;
+    }
+    return {first - nameOrder_.begin(), last - nameOrder_.begin()};
+}
 
 const scalar_variable& model_variables::getByName(const std::string& name) const
 {
-    for (auto& v : variables_) {
-        if (v.name == name) {
-            return v;
-        }
+    const auto it = std::lower_bound(nameOrder_.begin(), nameOrder_.end(), name, [this](size_t i, const std::string& n) {
+        return variables_[i].name < n;
+    });
+    if (it != nameOrder_.end() && variables_[*it].name == name) {
+        return variables_[*it];
     }
     throw std::runtime_error("No such variable with name '" + name + "'!");
 }
 
 const scalar_variable& model_variables::getByValueReference(const fmi2ValueReference vr) const
 {
-    for (const auto& var : variables_) {
-        if (var.value_reference == vr) {
-            return var;
-        }
+    // the first declared variable wins when several base types share vr
+    size_t first = variables_.size();
+    for (auto it = vr_lower_bound(vr); it != vrOrder_.end() && variables_[*it].value_reference == vr; ++it) {
+        first = std::min(first, *it);
+    }
+    if (first < variables_.size()) {
+        return variables_[first];
     }
     throw std::runtime_error("No such variable with valueReference '" + std::to_string(vr) + "'!");
 }
@@ -37,10 +227,13 @@ void model_variables::getByValueReference(
     const fmi2ValueReference vr,
     std::vector<scalar_variable>& store) const
 {
-    for (const auto& var : variables_) {
-        if (var.value_reference == vr) {
-            store.push_back(var);
-        }
+    std::vector<size_t> indices;
+    for (auto it = vr_lower_bound(vr); it != vrOrder_.end() && variables_[*it].value_reference == vr; ++it) {
+        indices.push_back(*it);
+    }
+    std::sort(indices.begin(), indices.end());
+    for (const auto index : indices) {
+        store.push_back(variables_[index]);
     }
 }
 
@@ -48,11 +241,142 @@ void model_variables::getByCausality(
     const causality causality,
     std::vector<scalar_variable>& store) const
 {
-    for (const auto& var : variables_) {
-        if (var.causality == causality) {
-            store.push_back(var);
+    for (const auto index : by_causality(causality).indices) {
+        store.push_back(variables_[index]);
+    }
+}
+
+std::vector<size_t> model_variables::find_by_prefix(const std::string& prefix) const
+{
+    const auto [first, last] = prefix_range(prefix);
+    std::vector<size_t> indices(nameOrder_.begin() + first, nameOrder_.begin() + last);
+    std::sort(indices.begin(), indices.end());
+    return indices;
+}
+
+std::vector<size_t> model_variables::find_by_glob(const std::string& pattern) const
+{
+    // only names sharing the literal part in front of the first wildcard can match
+    const auto literal = pattern.substr(0, pattern.find_first_of("*?"));
+    const auto [first, last] = prefix_range(literal);
+
+    std::vector<size_t> indices;
+    for (size_t i = first; i < last; i++) {
+        const auto index = nameOrder_[i];
+        if (glob_match(variables_[index].name, literal.size(), pattern, literal.size())) {
+            indices.push_back(index);
+        }
+    }
+    std::sort(indices.begin(), indices.end());
+    return indices;
+}
+
+std::vector<size_t> model_variables::find_by_array_index(
+    const std::string& arrayName,
+    const size_t first,
+    const size_t last) const
+{
+    const auto prefix = arrayName + "[";
+    const auto [begin, end] = prefix_range(prefix);
+
+    std::vector<size_t> indices;
+    for (size_t i = begin; i < end; i++) {
+        const auto index = nameOrder_[i];
+        const auto& name = variables_[index].name;
+
+        size_t pos = prefix.size();
+        size_t value = 0;
+        while (pos < name.size() && std::isdigit(static_cast<unsigned char>(name[pos]))) {
+            value = value * 10 + (name[pos++] - '0');
+        }
+        if (pos == prefix.size() || pos == name.size() || (name[pos] != ']' && name[pos] != ',')) {
+            continue;
+        }
+        if (value >= first && value <= last) {
+            indices.push_back(index);
+        }
+    }
+    std::sort(indices.begin(), indices.end());
+    return indices;
+}
+
+value_reference_set model_variables::value_references(const std::vector<size_t>& indices) const
+{
+    value_reference_set set;
+    for (const auto index : indices) {
+        add_value_reference(set, variables_[index]);
+    }
+    return set;
+}
+
+const std::vector<size_t>& model_variables::aliases(const size_t index) const
+{
+    return aliasGroups_[aliasGroupOf_[index]];
+}
+
+alias_read_set model_variables::read_set(const std::vector<size_t>& indices) const
+{
+    alias_read_set set;
+    std::vector<size_t> slotOfGroup(aliasGroups_.size(), SIZE_MAX);
+
+    for (size_t position = 0; position < indices.size(); position++) {
+        const auto& v = variables_[indices[position]];
+        std::vector<fmi4cppValueReference>* vrs;
+        std::vector<std::vector<size_t>>* targets;
+        switch (access_type_of(v)) {
+            case access_type::real:
+                vrs = &set.value_references.reals;
+                targets = &set.real_targets;
+                break;
+            case access_type::boolean:
+                vrs = &set.value_references.booleans;
+                targets = &set.boolean_targets;
+                break;
+            case access_type::string:
+                vrs = &set.value_references.strings;
+                targets = &set.string_targets;
+                break;
+            default:
+                vrs = &set.value_references.integers;
+                targets = &set.integer_targets;
+                break;
+        }
+
+        auto& slot = slotOfGroup[aliasGroupOf_[indices[position]]];
+        if (slot == SIZE_MAX) {
+            slot = vrs->size();
+            vrs->push_back(v.value_reference);
+            targets->emplace_back();
         }
+        (*targets)[slot].push_back(position);
     }
+
+    return set;
+}
+
+const parameter_set& model_variables::start_values() const
+{
+    return startValues_;
+}
+
+const variable_partition& model_variables::by_causality(const causality causality) const
+{
+    return causalities_[static_cast<size_t>(causality)];
+}
+
+const variable_partition& model_variables::by_variability(const variability variability) const
+{
+    return variabilities_[static_cast<size_t>(variability)];
+}
+
+const variable_partition& model_variables::states() const
+{
+    return states_;
+}
+
+const variable_partition& model_variables::derivatives() const
+{
+    return derivatives_;
 }
 
 size_t model_variables::size() const
@@ -0,0 +1,108 @@
+
+#ifndef FMI4CPP_PARSERHELPER_HPP
+#define FMI4CPP_PARSERHELPER_HPP
+
+#include <fmi4cpp/fmi2/xml/scalar_variable.hpp>
+#include <fmi4cpp/fmi2/xml/type_definitions.hpp>
+#include <fmi4cpp/fmi2/xml/unit_definitions.hpp>
+
+#include <charconv>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace fmi4cpp::fmi2::detail
+{
+
+inline void split(std::vector<std::string>& store, std::string_view target, char c)
+{
+    size_t pos = 0;
+    while (pos < target.size()) {
+        auto end = target.find(c, pos);
+        if (end == std::string_view::npos) {
+            end = target.size();
+        }
+        store.emplace_back(target.substr(pos, end - pos));
+        pos = end + 1;
+    }
+}
+
+inline void parse_unknown_dependencies_kind(std::string_view str, std::vector<std::string>& store)
+{
+    split(store, str, ' ');
+}
+
+inline void parse_unknown_dependencies(std::string_view str, std::vector<unsigned int>& store)
+{
+    const char* first = str.data();
+    const char* last = first + str.size();
+    while (first != last) {
+        if (*first == ' ' || *first == ',' || *first == '\t' || *first == '\n' || *first == '\r') {
+            first++;
+            continue;
+        }
+        unsigned int i;
+        const auto [ptr, ec] = std::from_chars(first, last, i);
+        if (ec != std::errc()) {
+            break;
+        }
+        store.push_back(i);
+        first = ptr;
+    }
+}
+
+template<typename T>
+void resolve_declared_type(
+    fmi4cpp::fmi2::scalar_variable_attribute<T>& attributes,
+    const std::optional<std::string>& declaredType,
+    const fmi4cpp::fmi2::type_definitions& types)
+{
+    if (declaredType) {
+        attributes.declared_type_id = types.find(*declaredType);
+    }
+}
+
+/**
+ * Looks up the ids of unit and display unit, adding the unit to the table if it is not defined there.
+ */
+template<typename T>
+void resolve_unit_ids(
+    T& attributes,
+    fmi4cpp::fmi2::unit_definitions& units,
+    const std::optional<std::string>& unit,
+    const std::optional<std::string>& displayUnit)
+{
+    if (unit) {
+        attributes.unit_id = units.find_or_add(*unit);
+        if (displayUnit) {
+            attributes.display_unit_id = units.find_display_unit(*attributes.unit_id, *displayUnit);
+        }
+    }
+}
+
+/**
+ * Looks up the ids of unit and display unit, falling back to the ones of the declared type when not given.
+ */
+inline void resolve_units(
+    fmi4cpp::fmi2::real_attribute& attributes,
+    std::optional<std::string> unit,
+    std::optional<std::string> displayUnit,
+    fmi4cpp::fmi2::unit_definitions& units,
+    const fmi4cpp::fmi2::type_definitions& types)
+{
+    if (attributes.declared_type_id) {
+        const auto& type = types[*attributes.declared_type_id];
+        if (!unit) {
+            unit = type.unit;
+        }
+        if (!displayUnit) {
+            displayUnit = type.display_unit;
+        }
+    }
+    resolve_unit_ids(attributes, units, unit, displayUnit);
+}
+
+} // namespace fmi4cpp::fmi2::detail
+
+#endif //FMI4CPP_PARSERHELPER_HPP
@@ -124,12 +124,30 @@ real_variable::real_variable(
 
 std::optional<std::string> real_variable::displayUnit() const
 {
-    return attribute_.display_unit;
+    const auto& units = variable().unit_definitions;
+    if (!attribute_.unit_id || !attribute_.display_unit_id || !units) {
+        return std::nullopt;
+    }
+    return (*units)[*attribute_.unit_id].display_units[*attribute_.display_unit_id].name;
+}
+
+std::optional<unsigned int> real_variable::unitId() const
+{
+    return attribute_.unit_id;
+}
+
+std::optional<unsigned int> real_variable::displayUnitId() const
+{
+    return attribute_.display_unit_id;
 }
 
 std::optional<std::string> real_variable::unit() const
 {
-    return attribute_.unit;
+    const auto& units = variable().unit_definitions;
+    if (!attribute_.unit_id || !units) {
+        return std::nullopt;
+    }
+    return (*units)[*attribute_.unit_id].name;
 }
 
 std::optional<unsigned int> real_variable::derivative() const
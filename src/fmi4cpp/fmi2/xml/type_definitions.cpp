@@ -0,0 +1,31 @@
+
+#include <fmi4cpp/fmi2/xml/type_definitions.hpp>
+
+using namespace fmi4cpp::fmi2;
+
+type_definitions::type_definitions(std::vector<simple_type> types)
+    : types_(std::move(types))
+{
+    for (unsigned int id = 0; id < types_.size(); id++) {
+        ids_.emplace(types_[id].name, id);
+    }
+}
+
+size_t type_definitions::size() const
+{
+    return types_.size();
+}
+
+const simple_type& type_definitions::operator[](const unsigned int id) const
+{
+    return types_[id];
+}
+
+std::optional<unsigned int> type_definitions::find(const std::string& name) const
+{
+    const auto it = ids_.find(name);
+    if (it == ids_.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
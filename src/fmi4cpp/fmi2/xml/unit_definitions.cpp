@@ -0,0 +1,77 @@
+
+#include <fmi4cpp/fmi2/xml/unit_definitions.hpp>
+
+using namespace fmi4cpp::fmi2;
+
+unit_definitions::unit_definitions(std::vector<unit> units)
+    : units_(std::move(units))
+{
+    for (unsigned int id = 0; id < units_.size(); id++) {
+        ids_.emplace(units_[id].name, id);
+    }
+}
+
+size_t unit_definitions::size() const
+{
+    return units_.size();
+}
+
+const unit& unit_definitions::operator[](const unsigned int id) const
+{
+    return units_[id];
+}
+
+std::optional<unsigned int> unit_definitions::find(const std::string& name) const
+{
+    const auto it = ids_.find(name);
+    if (it == ids_.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+unsigned int unit_definitions::find_or_add(const std::string& name)
+{
+    const auto [it, added] = ids_.emplace(name, static_cast<unsigned int>(units_.size()));
+    if (added) {
+        units_.push_back({name, std::nullopt, {}});
+    }
+    return it->second;
+}
+
+std::optional<unsigned int> unit_definitions::find_display_unit(const unsigned int unitId, const std::string& name) const
+{
+    const auto& displayUnits = units_[unitId].display_units;
+    for (unsigned int id = 0; id < displayUnits.size(); id++) {
+        if (displayUnits[id].name == name) {
+            return id;
+        }
+    }
+    return std::nullopt;
+}
+
+unit_conversion unit_definitions::to_display_unit(const unsigned int unitId, const unsigned int displayUnitId) const
+{
+    const auto& displayUnit = units_[unitId].display_units[displayUnitId];
+    return {displayUnit.factor, displayUnit.offset};
+}
+
+unit_conversion unit_definitions::to_base_unit(const unsigned int unitId) const
+{
+    const auto& baseUnit = units_[unitId].base_unit;
+    if (!baseUnit) {
+        return {};
+    }
+    return {baseUnit->factor, baseUnit->offset};
+}
+
+std::optional<unit_conversion> unit_definitions::conversion(const unsigned int fromUnitId, const unsigned int toUnitId) const
+{
+    const auto& from = units_[fromUnitId].base_unit;
+    const auto& to = units_[toUnitId].base_unit;
+    if (!from || !to || !from->same_dimension(*to)) {
+        return std::nullopt;
+    }
+    // to base unit with from, then back with the inverse of to
+    return unit_conversion{from->factor / to->factor, (from->offset - to->offset) / to->factor};
+}
@@ -0,0 +1,392 @@
+
+#ifndef FMI4CPP_XMLSTREAMREADER_HPP
+#define FMI4CPP_XMLSTREAMREADER_HPP
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <istream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace fmi4cpp::fmi2::detail
+{
+
+/**
+ * Minimal pull parser that walks an XML document tag by tag, keeping only a fixed size read buffer
+ * and the attributes of the current tag in memory. Text, comments, processing instructions,
+ * CDATA sections and DOCTYPE declarations are skipped, as the model description carries all
+ * of its information in elements and attributes.
+ */
+class xml_stream_reader
+{
+
+public:
+    enum class event
+    {
+        start,
+        end
+    };
+
+private:
+    std::istream& in_;
+    std::vector<char> buffer_;
+    size_t pos_ = 0;
+    size_t end_ = 0;
+
+    bool latin1_ = false;
+    bool pendingEnd_ = false;
+
+    event event_ = event::end;
+    std::string name_;
+    std::vector<std::pair<std::string, std::string>> attributes_;
+    size_t numAttributes_ = 0;
+
+    [[noreturn]] static void fail(const std::string& what)
+    {
+        throw std::runtime_error("Unable to parse modelDescription.xml: " + what);
+    }
+
+    bool fill()
+    {
+        in_.read(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+        pos_ = 0;
+        end_ = static_cast<size_t>(in_.gcount());
+        return end_ > 0;
+    }
+
+    int get()
+    {
+        if (pos_ == end_ && !fill()) {
+            return EOF;
+        }
+        return static_cast<unsigned char>(buffer_[pos_++]);
+    }
+
+    int peek()
+    {
+        if (pos_ == end_ && !fill()) {
+            return EOF;
+        }
+        return static_cast<unsigned char>(buffer_[pos_]);
+    }
+
+    int get_or_fail()
+    {
+        const int c = get();
+        if (c == EOF) {
+            fail("unexpected end of file");
+        }
+        return c;
+    }
+
+    static bool is_space(int c)
+    {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+    }
+
+    int skip_spaces()
+    {
+        int c = get_or_fail();
+        while (is_space(c)) {
+            c = get_or_fail();
+        }
+        return c;
+    }
+
+    void skip_until(const char* terminator)
+    {
+        const size_t len = std::strlen(terminator);
+        size_t matched = 0;
+        while (matched < len) {
+            const int c = get_or_fail();
+            // on a mismatch, fall back to the longest prefix of the terminator that still ends the input read,
+            // so that "]]]>" ends a CDATA section
+            while (matched > 0 && c != static_cast<unsigned char>(terminator[matched])) {
+                matched = longest_border(terminator, matched);
+            }
+            if (c == static_cast<unsigned char>(terminator[matched])) {
+                matched++;
+            }
+        }
+    }
+
+    /**
+     * Length of the longest proper prefix of str[0, n) that is also a suffix of it.
+     */
+    static size_t longest_border(const char* str, size_t n)
+    {
+        for (size_t k = n - 1; k > 0; k--) {
+            if (std::memcmp(str, str + n - k, k) == 0) {
+                return k;
+            }
+        }
+        return 0;
+    }
+
+    void append(std::string& str, int c) const
+    {
+        if (latin1_ && c >= 0x80) {
+            str.push_back(static_cast<char>(0xC0 | (c >> 6)));
+            str.push_back(static_cast<char>(0x80 | (c & 0x3F)));
+        } else {
+            str.push_back(static_cast<char>(c));
+        }
+    }
+
+    static void append_utf8(std::string& str, unsigned long cp)
+    {
+        if (cp < 0x80) {
+            str.push_back(static_cast<char>(cp));
+        } else if (cp < 0x800) {
+            str.push_back(static_cast<char>(0xC0 | (cp >> 6)));
+            str.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+        } else if (cp < 0x10000) {
+            str.push_back(static_cast<char>(0xE0 | (cp >> 12)));
+            str.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+            str.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+        } else {
+            str.push_back(static_cast<char>(0xF0 | (cp >> 18)));
+            str.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+            str.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+            str.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+        }
+    }
+
+    void read_entity(std::string& str)
+    {
+        char entity[16];
+        size_t len = 0;
+        int c = get_or_fail();
+        while (c != ';') {
+            if (len == sizeof(entity) - 1) {
+                fail("malformed entity reference");
+            }
+            entity[len++] = static_cast<char>(c);
+            c = get_or_fail();
+        }
+        entity[len] = '\0';
+
+        if (std::strcmp(entity, "lt") == 0) {
+            str.push_back('<');
+        } else if (std::strcmp(entity, "gt") == 0) {
+            str.push_back('>');
+        } else if (std::strcmp(entity, "amp") == 0) {
+            str.push_back('&');
+        } else if (std::strcmp(entity, "quot") == 0) {
+            str.push_back('"');
+        } else if (std::strcmp(entity, "apos") == 0) {
+            str.push_back('\'');
+        } else if (entity[0] == '#') {
+            const bool hex = entity[1] == 'x';
+            append_utf8(str, std::strtoul(entity + (hex ? 2 : 1), nullptr, hex ? 16 : 10));
+        } else {
+            fail("unknown entity '&" + std::string(entity) + ";'");
+        }
+    }
+
+    void read_declaration()
+    {
+        std::string content;
+        int c = get_or_fail();
+        while (!(c == '?' && peek() == '>')) {
+            content.push_back(static_cast<char>(c));
+            c = get_or_fail();
+        }
+        get();
+
+        if (content.compare(0, 4, "xml ") == 0) {
+            const auto pos = content.find("encoding");
+            if (pos != std::string::npos) {
+                const auto quote = content.find_first_of("\"'", pos);
+                const auto closingQuote = quote == std::string::npos ? quote : content.find(content[quote], quote + 1);
+                if (closingQuote == std::string::npos) {
+                    fail("unquoted encoding in XML declaration");
+                }
+                const auto encoding = content.substr(quote + 1, closingQuote - quote - 1);
+                std::string lower;
+                for (const char ch : encoding) {
+                    lower.push_back(static_cast<char>(std::tolower(static_cast<unsigned char>(ch))));
+                }
+                latin1_ = lower == "iso-8859-1" || lower == "latin1" || lower == "latin-1";
+            }
+        }
+    }
+
+    void skip_markup_declaration()
+    {
+        if (peek() == '-') {
+            get();
+            if (get_or_fail() != '-') {
+                fail("malformed comment");
+            }
+            skip_until("-->");
+        } else if (peek() == '[') {
+            skip_until("]]>");
+        } else {
+            int depth = 0;
+            int c = get_or_fail();
+            while (c != '>' || depth > 0) {
+                if (c == '[') depth++;
+                if (c == ']') depth--;
+                c = get_or_fail();
+            }
+        }
+    }
+
+    void read_end_tag()
+    {
+        name_.clear();
+        int c = get_or_fail();
+        while (c != '>' && !is_space(c)) {
+            append(name_, c);
+            c = get_or_fail();
+        }
+        while (c != '>') {
+            c = get_or_fail();
+        }
+        event_ = event::end;
+    }
+
+    void read_start_tag(int c)
+    {
+        name_.clear();
+        while (c != '>' && c != '/' && !is_space(c)) {
+            append(name_, c);
+            c = get_or_fail();
+        }
+
+        numAttributes_ = 0;
+        while (true) {
+            if (is_space(c)) {
+                c = skip_spaces();
+            }
+            if (c == '>') {
+                break;
+            }
+            if (c == '/') {
+                if (get_or_fail() != '>') {
+                    fail("malformed tag '" + name_ + "'");
+                }
+                pendingEnd_ = true;
+                break;
+            }
+
+            if (numAttributes_ == attributes_.size()) {
+                attributes_.emplace_back();
+            }
+            auto& [attributeName, value] = attributes_[numAttributes_++];
+            attributeName.clear();
+            value.clear();
+
+            while (c != '=' && !is_space(c)) {
+                append(attributeName, c);
+                c = get_or_fail();
+            }
+            if (is_space(c)) {
+                c = skip_spaces();
+            }
+            if (c != '=') {
+                fail("missing value for attribute '" + attributeName + "'");
+            }
+            const int quote = skip_spaces();
+            if (quote != '"' && quote != '\'') {
+                fail("unquoted value for attribute '" + attributeName + "'");
+            }
+            c = get_or_fail();
+            while (c != quote) {
+                if (c == '&') {
+                    read_entity(value);
+                } else if (is_space(c)) {
+                    value.push_back(' ');
+                } else {
+                    append(value, c);
+                }
+                c = get_or_fail();
+            }
+            c = get_or_fail();
+        }
+        event_ = event::start;
+    }
+
+public:
+    explicit xml_stream_reader(std::istream& in, size_t bufferSize = 64 * 1024)
+        : in_(in)
+        , buffer_(bufferSize)
+    {
+        if (peek() == 0xEF) {
+            if (get() != 0xEF || get() != 0xBB || get() != 0xBF) {
+                fail("malformed byte order mark");
+            }
+        } else if (peek() == 0xFE || peek() == 0xFF || peek() == 0x00) {
+            fail("only UTF-8 and ISO-8859-1 encoded files are supported");
+        }
+    }
+
+    /**
+     * Advances to the next start or end tag. A self-closing tag yields a start event followed by an end event.
+     * Returns false once the input is exhausted.
+     */
+    bool next()
+    {
+        if (pendingEnd_) {
+            pendingEnd_ = false;
+            numAttributes_ = 0;
+            event_ = event::end;
+            return true;
+        }
+
+        while (true) {
+            int c = get();
+            if (c == EOF) {
+                return false;
+            }
+            if (c != '<') {
+                continue;
+            }
+
+            c = get_or_fail();
+            if (c == '?') {
+                read_declaration();
+            } else if (c == '!') {
+                skip_markup_declaration();
+            } else if (c == '/') {
+                read_end_tag();
+                return true;
+            } else {
+                read_start_tag(c);
+                return true;
+            }
+        }
+    }
+
+    [[nodiscard]] bool is_start() const
+    {
+        return event_ == event::start;
+    }
+
+    [[nodiscard]] const std::string& name() const
+    {
+        return name_;
+    }
+
+    /**
+     * Value of the named attribute on the current start tag, or nullptr when it is not present.
+     */
+    [[nodiscard]] const char* attribute(const char* name) const
+    {
+        for (size_t i = 0; i < numAttributes_; i++) {
+            if (attributes_[i].first == name) {
+                return attributes_[i].second.c_str();
+            }
+        }
+        return nullptr;
+    }
+};
+
+} // namespace fmi4cpp::fmi2::detail
+
+#endif //FMI4CPP_XMLSTREAMREADER_HPP
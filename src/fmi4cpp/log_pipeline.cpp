@@ -0,0 +1,214 @@
+
+#include <fmi4cpp/log_pipeline.hpp>
+#include <fmi4cpp/mlog.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <iostream>
+
+using namespace fmi4cpp;
+
+struct log_pipeline::slot
+{
+    // the position the slot is free for, or that position + 1 once it holds the message written there
+    std::atomic<uint64_t> sequence;
+
+    std::chrono::system_clock::time_point time;
+    fmi4cpp::status status;
+    bool truncated;
+
+    size_t instanceNameLength;
+    size_t categoryLength;
+    size_t messageLength;
+    char instanceName[max_name_length];
+    char category[max_name_length];
+    char message[max_message_length];
+};
+
+namespace
+{
+
+size_t copy_name(const char* name, char* out)
+{
+    if (name == nullptr) {
+        return 0;
+    }
+    const size_t length = strnlen(name, log_pipeline::max_name_length);
+    std::memcpy(out, name, length);
+    return length;
+}
+
+#if !defined(LOG_LEVEL_OFF) && !defined(MLOG_LEVEL_OFF)
+mlog_level to_level(fmi4cpp::status status)
+{
+    switch (status) {
+        case fmi4cpp::status::OK: return Info;
+        case fmi4cpp::status::Error: return Error;
+        case fmi4cpp::status::Fatal: return Fatal;
+        default: return Warn;
+    }
+}
+#endif
+
+} // namespace
+
+log_pipeline& log_pipeline::instance()
+{
+    static log_pipeline pipeline;
+    return pipeline;
+}
+
+void log_pipeline::console_sink(const log_record& record)
+{
+#if defined(LOG_LEVEL_OFF) || defined(MLOG_LEVEL_OFF)
+    (void)record;
+#else
+    // FMI4CPP_LOG_LEVEL applies to the messages of FMUs as to those of the library
+    if (to_level(record.status) < M_LOG_LEVEL) {
+        return;
+    }
+    auto& out = record.status >= fmi4cpp::status::Error ? std::cerr : std::cout;
+    out << "[FMI callback logger] status=" << to_string(record.status)
+        << ", instanceName=" << record.instance_name
+        << ", category=" << record.category
+        << ", message=" << record.message << (record.truncated ? "..." : "") << '\n';
+#endif
+}
+
+log_pipeline::log_pipeline()
+    : slots_(new slot[capacity])
+    , sinks_({console_sink})
+{
+    for (size_t i = 0; i < capacity; i++) {
+        slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    consumer_ = std::thread([this] { run(); });
+}
+
+log_pipeline::~log_pipeline()
+{
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex_);
+        stopping_ = true;
+    }
+    wake_.notify_one();
+    consumer_.join();
+}
+
+void log_pipeline::push(fmi4cppString instanceName, fmi4cpp::status status, fmi4cppString category,
+    fmi4cppString format, va_list args)
+{
+    uint64_t pos = enqueuePos_.load(std::memory_order_relaxed);
+    slot* s;
+    while (true) {
+        s = &slots_[pos % capacity];
+        const uint64_t sequence = s->sequence.load(std::memory_order_acquire);
+        if (sequence == pos) {
+            if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (sequence < pos) {
+            // the consumer has not freed the slot from the previous round yet
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        } else {
+            pos = enqueuePos_.load(std::memory_order_relaxed);
+        }
+    }
+
+    s->time = std::chrono::system_clock::now();
+    s->status = status;
+    s->instanceNameLength = copy_name(instanceName, s->instanceName);
+    s->categoryLength = copy_name(category, s->category);
+    const int length = format ? std::vsnprintf(s->message, max_message_length, format, args) : 0;
+    s->messageLength = std::clamp<size_t>(length < 0 ? 0 : static_cast<size_t>(length), 0, max_message_length - 1);
+    s->truncated = length >= static_cast<int>(max_message_length);
+
+    // sequentially consistent with the check of sleeping_, so either the consumer sees the message before
+    // it waits, or the push sees that it waits and wakes it
+    s->sequence.store(pos + 1, std::memory_order_seq_cst);
+    if (sleeping_.load(std::memory_order_seq_cst) && sleeping_.exchange(false)) {
+        std::lock_guard<std::mutex> lock(wakeMutex_);
+        wake_.notify_one();
+    }
+}
+
+void log_pipeline::set_sinks(std::vector<log_sink> sinks)
+{
+    std::lock_guard<std::mutex> lock(sinksMutex_);
+    sinks_ = std::move(sinks);
+}
+
+void log_pipeline::add_sink(log_sink sink)
+{
+    std::lock_guard<std::mutex> lock(sinksMutex_);
+    sinks_.push_back(std::move(sink));
+}
+
+void log_pipeline::flush()
+{
+    const uint64_t target = enqueuePos_.load(std::memory_order_acquire);
+    std::unique_lock<std::mutex> lock(wakeMutex_);
+    drained_.wait(lock, [&] { return dequeuePos_.load(std::memory_order_acquire) >= target; });
+}
+
+bool log_pipeline::ready() const
+{
+    const uint64_t pos = dequeuePos_.load(std::memory_order_relaxed);
+    return slots_[pos % capacity].sequence.load(std::memory_order_seq_cst) == pos + 1;
+}
+
+bool log_pipeline::drain()
+{
+    uint64_t pos = dequeuePos_.load(std::memory_order_relaxed);
+    const uint64_t first = pos;
+    std::lock_guard<std::mutex> lock(sinksMutex_);
+    while (true) {
+        auto& s = slots_[pos % capacity];
+        if (s.sequence.load(std::memory_order_acquire) != pos + 1) {
+            break;
+        }
+        const log_record record{s.time,
+            {s.instanceName, s.instanceNameLength},
+            s.status,
+            {s.category, s.categoryLength},
+            {s.message, s.messageLength},
+            s.truncated};
+        for (const auto& sink : sinks_) {
+            try {
+                sink(record);
+            } catch (const std::exception& ex) {
+                std::cerr << "[FMI callback logger] sink failed: " << ex.what() << '\n';
+            }
+        }
+        s.sequence.store(pos + capacity, std::memory_order_release);
+        dequeuePos_.store(++pos, std::memory_order_release);
+    }
+    return pos != first;
+}
+
+void log_pipeline::run()
+{
+    while (true) {
+        if (drain()) {
+            std::lock_guard<std::mutex> lock(wakeMutex_);
+            drained_.notify_all();
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(wakeMutex_);
+        sleeping_.store(true, std::memory_order_seq_cst);
+        wake_.wait(lock, [&] { return stopping_ || ready(); });
+        sleeping_.store(false, std::memory_order_relaxed);
+        if (stopping_) {
+            break;
+        }
+    }
+    drain();
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex_);
+        drained_.notify_all();
+    }
+    std::cout.flush();
+}
@@ -35,6 +35,18 @@ const char* to_string(mlog_level lvl)
     }
 }
 
+// std::ctime returns a shared buffer, so instances logging from different threads would race on it
+std::string to_time_string(std::time_t time)
+{
+    char buffer[32];
+#    ifdef _WIN32
+    ctime_s(buffer, sizeof(buffer), &time);
+#    else
+    ctime_r(&time, buffer);
+#    endif
+    return buffer;
+}
+
 #    if MLOG_LEVEL_TRACE
 mlog_level M_LOG_LEVEL = Trace;
 #    elif MLOG_LEVEL_DEBUG
@@ -58,12 +70,12 @@ mlog_level M_LOG_LEVEL = Info;
 #    define MLOG_ERROR(msg) _MLOG_(msg, Error)
 #    define MLOG_FATAL(msg) _MLOG_(msg, Fatal)
 
-#    define _MLOG_(msg, level)                                                                                                                    \
-        {                                                                                                                                         \
-            if (level >= M_LOG_LEVEL) {                                                                                                           \
-                auto time_now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());                                           \
-                __MLOG__("[" << to_string(level) << "] [" << std::ctime(&time_now) << "] " << __FILE__ << ":" << __LINE__ << ": " << msg, level); \
-            }                                                                                                                                     \
+#    define _MLOG_(msg, level)                                                                                                                       \
+        {                                                                                                                                            \
+            if (level >= M_LOG_LEVEL) {                                                                                                              \
+                auto time_now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());                                              \
+                __MLOG__("[" << to_string(level) << "] [" << to_time_string(time_now) << "] " << __FILE__ << ":" << __LINE__ << ": " << msg, level); \
+            }                                                                                                                                        \
         }
 
 #    define __MLOG__(msg, level)               \
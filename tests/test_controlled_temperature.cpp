@@ -5,6 +5,7 @@
 #include <catch2/catch.hpp>
 
 #include <string>
+#include <thread>
 
 using namespace fmi4cpp;
 
@@ -28,6 +29,7 @@ TEST_CASE("ControlledTemperature_test1")
 
     auto slave = fmu->new_instance();
     CHECK(slave->setup_experiment());
+    CHECK(slave->apply_start_values());
     CHECK(slave->enter_initialization_mode());
     CHECK(slave->exit_initialization_mode());
 
@@ -37,5 +39,257 @@ TEST_CASE("ControlledTemperature_test1")
 
     CHECK(298.15 == Approx(ref));
 
+    double buffer[1] = {0};
+    CHECK(slave->read_real(&vr, 1, buffer));
+    CHECK(ref == buffer[0]);
+
+    auto plan = fmu->get_model_description()->make_access_plan({"Temperature_Room", "Temperature_Reference"});
+    REQUIRE(2 == plan.size());
+    CHECK(slave->read(plan));
+    CHECK(ref == plan.value<base_type::real>(1));
+
+    const auto temperature = fmu->get_model_description()->get_variable_ref<base_type::real>("Temperature_Reference");
+    CHECK(slave->get(temperature, buffer[0]));
+    CHECK(ref == buffer[0]);
+    CHECK_THROWS(fmu->get_model_description()->get_variable_ref<base_type::integer>("Temperature_Room"));
+
+    value_frame frame(plan.value_references());
+    CHECK(slave->read_frame(frame));
+    CHECK(plan.values<base_type::real>() == frame.reals());
+
+    const auto& functions = slave->functions();
+    CHECK(slave->component() == functions.component);
+    CHECK(functions.callbacks != nullptr);
+    CHECK(functions.get_real != nullptr);
+    CHECK(functions.do_step != nullptr);
+    CHECK(functions.serialized_fmu_state_size != nullptr);
+    CHECK(functions.get_status != nullptr);
+    CHECK(functions.get_real_status != nullptr);
+    CHECK(functions.get_integer_status != nullptr);
+    CHECK(functions.get_boolean_status != nullptr);
+    CHECK(functions.get_string_status != nullptr);
+    // a co-simulation library has no model exchange functions
+    CHECK(functions.get_derivatives == nullptr);
+
+    double direct = 0;
+    CHECK(fmi2OK == functions.get_real(functions.component, &vr, 1, &direct));
+    CHECK(ref == direct);
+
+    auto& fastPath = slave->fast_path();
+    CHECK(fastPath.step(step_size));
+    CHECK(2 * step_size == Approx(slave->get_simulation_time()));
+    CHECK(fastPath.get_real(vr, ref));
+    CHECK(298.15 == Approx(ref));
+
+    CHECK(slave->terminate());
+}
+
+TEST_CASE("ControlledTemperature_cache")
+{
+    const std::string fmu_path = "../resources/fmus/2.0/cs/20sim/4.6.4.8004/"
+                                 "ControlledTemperature/ControlledTemperature.fmu";
+
+    auto fmu = fmi2::fmu(fmu_path).as_cs_fmu();
+    const fmi2ValueReference offset = 6; // Ramp.offset, a tunable parameter
+
+    auto slave = fmu->new_instance();
+    CHECK(slave->setup_experiment());
+    CHECK(slave->enter_initialization_mode());
+    CHECK(slave->exit_initialization_mode());
+
+    value_reference_set eager;
+    eager.reals.push_back(offset);
+    slave->enable_cache(eager);
+    REQUIRE(slave->cache_enabled());
+
+    // a write invalidates what was read before it
+    double value = 0;
+    CHECK(slave->read_real(offset, value));
+    CHECK(298.15 == Approx(value));
+    CHECK(slave->write_real(offset, 305.0));
+    CHECK(slave->read_real(offset, value));
+    CHECK(305.0 == Approx(value));
+
+    // also when written through the base class
+    auto plan = fmu->get_model_description()->make_access_plan({"Ramp.offset"});
+    plan.value<base_type::real>(0) = 315.0;
+    fmu_instance_base<fmi2::cs_library, fmi2::cs_model_description>& base = *slave;
+    CHECK(base.write(plan));
+    CHECK(slave->read_real(offset, value));
+    CHECK(315.0 == Approx(value));
+
+    // eager values are read right after the step, so a later write through fast_path() goes unseen
+    CHECK(slave->step(step_size));
+    CHECK(slave->fast_path().set_real(offset, 325.0));
+    CHECK(slave->read_real(offset, value));
+    CHECK(315.0 == Approx(value));
+
+    slave->invalidate_cache();
+    CHECK(slave->read_real(offset, value));
+    CHECK(325.0 == Approx(value));
+
+    slave->disable_cache();
+    CHECK(!slave->cache_enabled());
+
+    CHECK(slave->terminate());
+}
+
+TEST_CASE("ControlledTemperature_write_buffering")
+{
+    const std::string fmu_path = "../resources/fmus/2.0/cs/20sim/4.6.4.8004/"
+                                 "ControlledTemperature/ControlledTemperature.fmu";
+
+    auto fmu = fmi2::fmu(fmu_path).as_cs_fmu();
+    const fmi2ValueReference offset = 6; // Ramp.offset, a tunable parameter
+
+    auto slave = fmu->new_instance();
+    CHECK(slave->setup_experiment());
+    CHECK(slave->enter_initialization_mode());
+    CHECK(slave->exit_initialization_mode());
+
+    // fast_path() reads bypass the buffer, showing what the FMU holds
+    double value = 0;
+    slave->enable_write_buffering();
+    CHECK(slave->write_real(offset, 300.0));
+    CHECK(slave->write_real(offset, 310.0));
+    CHECK(slave->fast_path().get_real(offset, value));
+    CHECK(298.15 == Approx(value));
+
+    CHECK(slave->step(step_size));
+    CHECK(slave->fast_path().get_real(offset, value));
+    CHECK(310.0 == Approx(value));
+
+    // batch writes through the base class are buffered too, so the last write still wins
+    auto plan = fmu->get_model_description()->make_access_plan({"Ramp.offset"});
+    plan.value<base_type::real>(0) = 320.0;
+    CHECK(slave->write_real(offset, 330.0));
+    fmu_instance_base<fmi2::cs_library, fmi2::cs_model_description>& base = *slave;
+    CHECK(base.write(plan));
+    CHECK(slave->fast_path().get_real(offset, value));
+    CHECK(310.0 == Approx(value));
+
+    CHECK(slave->flush());
+    CHECK(slave->fast_path().get_real(offset, value));
+    CHECK(320.0 == Approx(value));
+
+    // reads flush first
+    CHECK(slave->write_real(offset, 340.0));
+    CHECK(slave->read_real(offset, value));
+    CHECK(340.0 == Approx(value));
+
+    CHECK(slave->write_real(offset, 350.0));
+    CHECK(slave->disable_write_buffering());
+    CHECK(!slave->write_buffering_enabled());
+    CHECK(slave->fast_path().get_real(offset, value));
+    CHECK(350.0 == Approx(value));
+
     CHECK(slave->terminate());
-}
\ No newline at end of file
+}
+
+TEST_CASE("ControlledTemperature_threads")
+{
+    const std::string fmu_path = "../resources/fmus/2.0/cs/20sim/4.6.4.8004/"
+                                 "ControlledTemperature/ControlledTemperature.fmu";
+
+    auto fmu = fmi2::fmu(fmu_path).as_cs_fmu();
+
+    // instances of one FMU stepped concurrently keep their own time and status
+    auto slave1 = fmu->new_instance();
+    auto slave2 = fmu->new_instance();
+    auto run = [](fmi2::cs_slave& slave, size_t steps, bool& ok) {
+        ok = slave.setup_experiment() && slave.enter_initialization_mode() && slave.exit_initialization_mode();
+        for (size_t i = 0; ok && i < steps; i++) {
+            ok = slave.step(step_size);
+        }
+    };
+
+    bool ok1 = false, ok2 = false;
+    std::thread thread1([&] { run(*slave1, 100, ok1); });
+    std::thread thread2([&] { run(*slave2, 40, ok2); });
+    thread1.join();
+    thread2.join();
+
+    CHECK(ok1);
+    CHECK(ok2);
+    CHECK(100 * step_size == Approx(slave1->get_simulation_time()));
+    CHECK(40 * step_size == Approx(slave2->get_simulation_time()));
+    CHECK(status::OK == slave1->last_status());
+    CHECK(status::OK == slave2->last_status());
+
+    // each function table holds the component of its own instance
+    CHECK(slave1->component() == slave1->functions().component);
+    CHECK(slave2->component() == slave2->functions().component);
+    CHECK(slave1->functions().component != slave2->functions().component);
+
+    CHECK(slave1->terminate());
+    CHECK(slave2->terminate());
+}
+
+TEST_CASE("ControlledTemperature_group")
+{
+    const std::string fmu_path = "../resources/fmus/2.0/cs/20sim/4.6.4.8004/"
+                                 "ControlledTemperature/ControlledTemperature.fmu";
+
+    auto fmu = fmi2::fmu(fmu_path).as_cs_fmu();
+
+    fmi2::instance_group group(*fmu, 4);
+    REQUIRE(4 == group.size());
+    CHECK(group.setup_experiment());
+    for (size_t i = 0; i < group.size(); i++) {
+        CHECK(group[i].apply_start_values());
+    }
+    CHECK(group.enter_initialization_mode());
+    CHECK(group.exit_initialization_mode());
+    CHECK(group.step_all(step_size));
+
+    const auto plan = fmu->get_model_description()->make_access_plan({"Temperature_Reference"});
+    auto matrix = group.make_matrix(plan);
+    CHECK(group.read_all(matrix));
+    for (size_t i = 0; i < group.size(); i++) {
+        CHECK(298.15 == Approx(matrix.row<base_type::real>(0)[i]));
+    }
+
+    CHECK(group.terminate());
+}
+
+TEST_CASE("ControlledTemperature_group_threads")
+{
+    const std::string fmu_path = "../resources/fmus/2.0/cs/20sim/4.6.4.8004/"
+                                 "ControlledTemperature/ControlledTemperature.fmu";
+
+    auto fmu = fmi2::fmu(fmu_path).as_cs_fmu();
+
+    // 5 members over 2 threads, so the ranges are of uneven size
+    fmi2::instance_group group(*fmu, 5, 2);
+    REQUIRE(5 == group.size());
+    CHECK(group.setup_experiment());
+    CHECK(group.enter_initialization_mode());
+    CHECK(group.exit_initialization_mode());
+
+    // Ramp.offset is a tunable parameter, which Temperature_Reference follows until the ramp starts
+    const auto parameters = fmu->get_model_description()->make_access_plan({"Ramp.offset"});
+    auto inputs = group.make_matrix(parameters);
+    for (size_t i = 0; i < group.size(); i++) {
+        inputs.row<base_type::real>(0)[i] = 300.0 + i;
+    }
+    CHECK(group.write_all(inputs));
+
+    for (int i = 0; i < 10; i++) {
+        CHECK(group.step_all(step_size));
+    }
+    for (size_t i = 0; i < group.size(); i++) {
+        CHECK(10 * step_size == Approx(group[i].get_simulation_time()));
+    }
+
+    const auto signals = fmu->get_model_description()->make_access_plan({"Ramp.offset", "Temperature_Reference"});
+    auto outputs = group.make_matrix(signals);
+    CHECK(group.read_all(outputs));
+    const auto offsetRow = signals.slot(0).index;
+    const auto referenceRow = signals.slot(1).index;
+    for (size_t i = 0; i < group.size(); i++) {
+        CHECK(300.0 + i == Approx(outputs.row<base_type::real>(offsetRow)[i]));
+        CHECK(300.0 + i == Approx(outputs.row<base_type::real>(referenceRow)[i]));
+    }
+
+    CHECK(group.terminate());
+}
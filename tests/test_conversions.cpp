@@ -0,0 +1,109 @@
+
+#include <fmi4cpp/conversions.hpp>
+
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace fmi4cpp;
+
+namespace
+{
+
+// lengths around the 4, 8, 16 and 32 element vector widths and the 64 bit words
+const size_t lengths[] = {0, 1, 3, 4, 7, 8, 15, 16, 17, 31, 32, 33, 63, 64, 65, 127, 128, 129, 1000};
+
+template<typename Narrow>
+long saturate(long value)
+{
+    return std::clamp<long>(value, std::numeric_limits<Narrow>::min(), std::numeric_limits<Narrow>::max());
+}
+
+} // namespace
+
+TEST_CASE("conversions_booleans")
+{
+    std::mt19937 rng(42);
+    for (const auto n : lengths) {
+        // any non-zero value is true, including negative ones and ones with the low byte clear
+        std::vector<fmi4cppBoolean> values(n);
+        for (auto& value : values) {
+            const auto kind = rng() % 4;
+            value = kind == 0 ? 0 : kind == 1 ? 1 : kind == 2 ? -256 : static_cast<fmi4cppBoolean>(rng());
+        }
+
+        std::vector<uint8_t> bytes(n);
+        booleans_to_bytes(values.data(), n, bytes.data());
+        std::vector<fmi4cppBoolean> fromBytes(n);
+        bytes_to_booleans(bytes.data(), n, fromBytes.data());
+
+        // unused bits of the last word start out set, and must be cleared
+        std::vector<uint64_t> bits((n + 63) / 64, ~uint64_t(0));
+        booleans_to_bits(values.data(), n, bits.data());
+        std::vector<fmi4cppBoolean> fromBits(n);
+        bits_to_booleans(bits.data(), n, fromBits.data());
+
+        for (size_t i = 0; i < n; i++) {
+            const bool expected = values[i] != 0;
+            REQUIRE(expected == bytes[i]);
+            REQUIRE(expected == fromBytes[i]);
+            REQUIRE(expected == ((bits[i / 64] >> (i % 64)) & 1));
+            REQUIRE(expected == fromBits[i]);
+        }
+        if (n % 64 != 0) {
+            CHECK(0 == bits.back() >> (n % 64));
+        }
+    }
+}
+
+TEST_CASE("conversions_bytes_to_booleans")
+{
+    std::vector<uint8_t> bytes = {0, 1, 2, 0x80, 0xFF, 0, 0, 7, 1};
+    std::vector<fmi4cppBoolean> values(bytes.size());
+    bytes_to_booleans(bytes.data(), bytes.size(), values.data());
+    CHECK(std::vector<fmi4cppBoolean>{0, 1, 1, 1, 1, 0, 0, 1, 1} == values);
+
+    bool flags[3] = {true, false, true};
+    bytes_to_booleans(flags, 3, values.data());
+    CHECK(1 == values[0]);
+    CHECK(0 == values[1]);
+    CHECK(1 == values[2]);
+}
+
+TEST_CASE("conversions_integers")
+{
+    // the saturation edges of both narrow types, and the extremes of int
+    const std::vector<fmi4cppInteger> edges = {0, 1, -1, 127, 128, -128, -129, 255, 256,
+        32767, 32768, -32768, -32769, 65535, INT_MAX, INT_MIN};
+
+    std::mt19937 rng(7);
+    for (const auto n : lengths) {
+        std::vector<fmi4cppInteger> values(n);
+        for (size_t i = 0; i < n; i++) {
+            values[i] = rng() % 2 == 0 ? edges[i % edges.size()] : static_cast<fmi4cppInteger>(rng());
+        }
+
+        std::vector<int16_t> shorts(n);
+        narrow_integers(values.data(), n, shorts.data());
+        std::vector<int8_t> chars(n);
+        narrow_integers(values.data(), n, chars.data());
+
+        std::vector<fmi4cppInteger> widenedShorts(n);
+        widen_integers(shorts.data(), n, widenedShorts.data());
+        std::vector<fmi4cppInteger> widenedChars(n);
+        widen_integers(chars.data(), n, widenedChars.data());
+
+        for (size_t i = 0; i < n; i++) {
+            REQUIRE(saturate<int16_t>(values[i]) == shorts[i]);
+            REQUIRE(saturate<int8_t>(values[i]) == chars[i]);
+            REQUIRE(shorts[i] == widenedShorts[i]);
+            REQUIRE(chars[i] == widenedChars[i]);
+        }
+    }
+}
@@ -0,0 +1,100 @@
+
+#include <fmi4cpp/fmi2/fmi2.hpp>
+
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+using namespace fmi4cpp;
+
+const double step_size = 1E-3;
+
+TEST_CASE("Feedthrough_string_view")
+{
+    const std::string fmu_path = "../resources/fmus/2.0/me/Test-FMUs/0.0.1/"
+                                 "Feedthrough/Feedthrough.fmu";
+
+    auto fmu = fmi2::fmu(fmu_path).as_cs_fmu();
+    const auto stringParam = fmu->get_model_description()->get_value_reference("string_param");
+
+    auto slave = fmu->new_instance();
+    CHECK(slave->setup_experiment());
+    CHECK(slave->enter_initialization_mode());
+    CHECK(slave->exit_initialization_mode());
+
+    std::string_view first;
+    CHECK(slave->read_string_view(stringParam, first));
+    CHECK("Set me!" == first);
+
+    // reading the unchanged value again keeps the view
+    CHECK(slave->step(step_size));
+    std::string_view second;
+    CHECK(slave->read_string_view(stringParam, second));
+    CHECK(first.data() == second.data());
+    CHECK("Set me!" == first);
+
+    CHECK(slave->terminate());
+}
+
+TEST_CASE("Feedthrough_discrete_conversions")
+{
+    const std::string fmu_path = "../resources/fmus/2.0/me/Test-FMUs/0.0.1/"
+                                 "Feedthrough/Feedthrough.fmu";
+
+    auto fmu = fmi2::fmu(fmu_path).as_cs_fmu();
+    const auto md = fmu->get_model_description();
+    const auto intIn = md->get_value_reference("int_in");
+    const auto intOut = md->get_value_reference("int_out");
+    const auto boolIn = md->get_value_reference("bool_in");
+    const auto boolOut = md->get_value_reference("bool_out");
+    const auto stringParam = md->get_value_reference("string_param");
+
+    auto slave = fmu->new_instance();
+    CHECK(slave->setup_experiment());
+    CHECK(slave->enter_initialization_mode());
+    // bool_out only follows bool_in for this string
+    CHECK(slave->write_string(stringParam, "FMI is awesome!"));
+    CHECK(slave->exit_initialization_mode());
+
+    // narrowed writes are widened, and reads out of range saturate
+    const int8_t small = -42;
+    CHECK(slave->write_integer_narrowed(&intIn, 1, &small));
+    CHECK(slave->step(step_size));
+    int16_t wide = 0;
+    CHECK(slave->read_integer_narrowed(&intOut, 1, &wide));
+    CHECK(-42 == wide);
+
+    CHECK(slave->write_integer(intIn, 1000));
+    CHECK(slave->step(step_size));
+    int8_t narrow = 0;
+    CHECK(slave->read_integer_narrowed(&intOut, 1, &narrow));
+    CHECK(127 == narrow);
+    CHECK(slave->read_integer_narrowed(&intOut, 1, &wide));
+    CHECK(1000 == wide);
+
+    CHECK(slave->write_integer(intIn, -1000));
+    CHECK(slave->step(step_size));
+    CHECK(slave->read_integer_narrowed(&intOut, 1, &narrow));
+    CHECK(-128 == narrow);
+
+    // the unused bits of the word are cleared on read
+    const fmi2ValueReference booleans[] = {boolIn, boolOut};
+    uint64_t bits = 1;
+    CHECK(slave->write_boolean_bits(&boolIn, 1, &bits));
+    CHECK(slave->step(step_size));
+    bits = ~uint64_t(0);
+    CHECK(slave->read_boolean_bits(booleans, 2, &bits));
+    CHECK(0b11 == bits);
+
+    bits = 0;
+    CHECK(slave->write_boolean_bits(&boolIn, 1, &bits));
+    CHECK(slave->step(step_size));
+    bits = ~uint64_t(0);
+    CHECK(slave->read_boolean_bits(&boolOut, 1, &bits));
+    CHECK(0 == bits);
+
+    CHECK(slave->terminate());
+}
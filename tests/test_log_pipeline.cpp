@@ -0,0 +1,143 @@
+
+#include <fmi4cpp/log_pipeline.hpp>
+
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>
+
+#include <chrono>
+#include <cstdarg>
+#include <future>
+#include <string>
+#include <vector>
+
+using namespace fmi4cpp;
+
+namespace
+{
+
+struct captured
+{
+    std::string instance_name;
+    fmi4cpp::status status;
+    std::string category;
+    std::string message;
+    bool truncated;
+};
+
+void log(log_pipeline& pipeline, fmi4cpp::status status, fmi4cppString format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    pipeline.push("instance", status, "category", format, args);
+    va_end(args);
+}
+
+} // namespace
+
+TEST_CASE("log_pipeline_delivery")
+{
+    std::vector<captured> records;
+    log_pipeline pipeline;
+    pipeline.set_sinks({[&](const log_record& record) {
+        records.push_back({std::string(record.instance_name), record.status, std::string(record.category),
+            std::string(record.message), record.truncated});
+    }});
+
+    log(pipeline, status::OK, "step %d of %s", 1, "two");
+    log(pipeline, status::Error, "failed");
+    pipeline.flush();
+
+    REQUIRE(2 == records.size());
+    CHECK("instance" == records[0].instance_name);
+    CHECK("category" == records[0].category);
+    CHECK("step 1 of two" == records[0].message);
+    CHECK(status::OK == records[0].status);
+    CHECK(!records[0].truncated);
+    CHECK("failed" == records[1].message);
+    CHECK(status::Error == records[1].status);
+    CHECK(0 == pipeline.dropped());
+}
+
+TEST_CASE("log_pipeline_wakes_consumer")
+{
+    // the message reaches the sink without a flush
+    std::promise<std::string> delivered;
+    log_pipeline pipeline;
+    pipeline.set_sinks({[&](const log_record& record) { delivered.set_value(std::string(record.message)); }});
+
+    auto message = delivered.get_future();
+    log(pipeline, status::OK, "hello");
+    REQUIRE(std::future_status::ready == message.wait_for(std::chrono::seconds(10)));
+    CHECK("hello" == message.get());
+}
+
+TEST_CASE("log_pipeline_truncation")
+{
+    std::vector<captured> records;
+    log_pipeline pipeline;
+    pipeline.set_sinks({[&](const log_record& record) {
+        records.push_back({std::string(record.instance_name), record.status, std::string(record.category),
+            std::string(record.message), record.truncated});
+    }});
+
+    const std::string longMessage(2 * log_pipeline::max_message_length, 'x');
+    log(pipeline, status::Warning, "%s", longMessage.c_str());
+    const std::string fitting(log_pipeline::max_message_length - 1, 'y');
+    log(pipeline, status::Warning, "%s", fitting.c_str());
+    pipeline.flush();
+
+    REQUIRE(2 == records.size());
+    CHECK(records[0].truncated);
+    CHECK(log_pipeline::max_message_length - 1 == records[0].message.size());
+    CHECK(longMessage.substr(0, log_pipeline::max_message_length - 1) == records[0].message);
+    CHECK(!records[1].truncated);
+    CHECK(fitting == records[1].message);
+}
+
+TEST_CASE("log_pipeline_overload")
+{
+    std::promise<void> entered;
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    size_t delivered = 0;
+
+    log_pipeline pipeline;
+    pipeline.set_sinks({[&](const log_record&) {
+        if (delivered++ == 0) {
+            entered.set_value();
+            released.wait();
+        }
+    }});
+
+    // the consumer holds the first slot in the blocked sink, leaving capacity - 1 free
+    log(pipeline, status::OK, "first");
+    entered.get_future().wait();
+    const size_t extra = 10;
+    for (size_t i = 0; i < log_pipeline::capacity + extra; i++) {
+        log(pipeline, status::OK, "message %zu", i);
+    }
+    CHECK(extra + 1 == pipeline.dropped());
+
+    release.set_value();
+    pipeline.flush();
+    CHECK(log_pipeline::capacity == delivered);
+
+    // once drained, messages are accepted again
+    log(pipeline, status::OK, "after");
+    pipeline.flush();
+    CHECK(log_pipeline::capacity + 1 == delivered);
+    CHECK(extra + 1 == pipeline.dropped());
+}
+
+TEST_CASE("log_pipeline_drains_on_destruction")
+{
+    size_t delivered = 0;
+    {
+        log_pipeline pipeline;
+        pipeline.set_sinks({[&](const log_record&) { delivered++; }});
+        for (int i = 0; i < 100; i++) {
+            log(pipeline, status::OK, "message %d", i);
+        }
+    }
+    CHECK(100 == delivered);
+}
@@ -28,6 +28,7 @@ TEST_CASE("ControlledTemperature_test1")
 
     CHECK(md->supports_cs());
     CHECK(!md->supports_me());
+    CHECK(md_cs == md->as_cs_description());
 
     CHECK(120 == md->model_variables->size());
     CHECK(120 == md_cs->model_variables->size());
@@ -40,6 +41,10 @@ TEST_CASE("ControlledTemperature_test1")
     CHECK(298.0 == Approx(heatCapacity1.start().value()));
     CHECK("starting temperature" == heatCapacity1.description());
     CHECK(!heatCapacity1.quantity().has_value());
+    CHECK(!heatCapacity1.unitId().has_value());
+
+    CHECK(0 == md->unit_definitions->size());
+    CHECK(0 == md->type_definitions->size());
 
     auto& thermalConductor = md->model_variables->getByValueReference(12);
     CHECK("TemperatureSource.T" == thermalConductor.name);
@@ -55,6 +60,13 @@ TEST_CASE("ControlledTemperature_test1")
     CHECK(115 == modelStructureOutputs[0].index);
     CHECK(116 == modelStructureOutputs[1].index);
 
+    // no dependencies given, so the outputs count as depending on all inputs, of which there are none
+    const auto feedthrough = md->get_feedthrough_graph();
+    CHECK(0 == feedthrough.num_inputs());
+    REQUIRE(2 == feedthrough.num_outputs());
+    CHECK(feedthrough.full_dependency[0]);
+    CHECK(!feedthrough.has_feedthrough(0));
+
     std::optional<fmi2::default_experiment> de = md->default_experiment;
     CHECK(de.has_value());
     CHECK(0.0 == Approx(*de->startTime));
@@ -75,4 +87,75 @@ TEST_CASE("ControlledTemperature_test1")
     md->model_variables->getByCausality(fmi2::causality::output, outputs);
 
     CHECK(count == outputs.size());
-}
\ No newline at end of file
+
+    const auto& realOutputs = md->model_variables->by_causality(fmi2::causality::output).value_references.reals;
+    REQUIRE(2 == realOutputs.size());
+    CHECK(outputs[0].value_reference == realOutputs[0]);
+
+    std::vector<size_t> all(mv->size());
+    for (size_t i = 0; i < all.size(); i++) {
+        all[i] = i;
+    }
+    const auto readSet = mv->read_set(all);
+    CHECK(52 == readSet.value_references.size());
+
+    size_t fannedOut = 0;
+    fmi2::fan_out(readSet.value_references.reals, readSet.real_targets, [&](size_t position, unsigned int vr) {
+        CHECK(vr == (*mv)[all[position]].value_reference);
+        fannedOut++;
+    });
+    CHECK(118 == fannedOut);
+
+    const auto& startValues = mv->start_values();
+    CHECK(19 == startValues.real_vrs.size());
+    REQUIRE(startValues.real_vrs.size() == startValues.real_values.size());
+    CHECK(1 == startValues.real_vrs[1]);
+    CHECK(298.0 == Approx(startValues.real_values[1]));
+
+    auto heatCapacity = md->select_by_prefix("HeatCapacity1.");
+    CHECK(13 == heatCapacity.reals.size());
+    CHECK(heatCapacity.integers.empty());
+
+    auto ports = md->select_by_glob("HeatCapacity1.p?.T");
+    REQUIRE(3 == ports.size());
+    CHECK(21 == ports.reals[0]);
+}
+
+TEST_CASE("ControlledTemperature_streaming")
+{
+    const std::string fmu_path = "../resources/fmus/2.0/cs/20sim/4.6.4.8004/"
+                                 "ControlledTemperature/modelDescription.xml";
+
+    auto dom = fmi2::parse_model_description(fmu_path);
+    auto md = fmi2::parse_model_description_streaming(fmu_path);
+
+    CHECK(dom->guid == md->guid);
+    CHECK(dom->model_name == md->model_name);
+    CHECK(*dom->generation_tool == *md->generation_tool);
+    CHECK(md->supports_cs());
+    CHECK(!md->supports_me());
+
+    REQUIRE(dom->model_variables->size() == md->model_variables->size());
+    for (size_t i = 0; i < md->model_variables->size(); i++) {
+        const auto& expected = (*dom->model_variables)[i];
+        const auto& actual = (*md->model_variables)[i];
+        CHECK(expected.name == actual.name);
+        CHECK(expected.value_reference == actual.value_reference);
+        CHECK(expected.causality == actual.causality);
+        CHECK(expected.variability == actual.variability);
+        CHECK(expected.type_name() == actual.type_name());
+    }
+
+    const fmi2::real_variable& heatCapacity1 = md->get_variable_by_name("HeatCapacity1.T0").as_real();
+    CHECK(1 == heatCapacity1.valueReference());
+    CHECK(298.0 == Approx(heatCapacity1.start().value()));
+    CHECK("starting temperature" == heatCapacity1.description());
+
+    CHECK(10 == md->as_cs_description()->sourceFiles.size());
+
+    REQUIRE(2 == md->model_structure->outputs.size());
+    CHECK(115 == md->model_structure->outputs[0].index);
+    CHECK(116 == md->model_structure->outputs[1].index);
+
+    CHECK(20.0 == Approx(*md->default_experiment->stopTime));
+}
@@ -30,4 +30,194 @@ TEST_CASE("FmuExportCrossCompile_test1")
     REQUIRE(derivatives[0].dependencies_kind);
     REQUIRE(1 == derivatives[0].dependencies_kind.value().size());
     CHECK("dependent" == derivatives[0].dependencies_kind.value()[0]);
+
+    const auto& states = md->model_variables->states();
+    REQUIRE(2 == states.indices.size());
+    CHECK(0 == states.indices[0]);
+    CHECK(1 == states.indices[1]);
+    CHECK(2 == md->model_variables->derivatives().value_references.reals[0]);
+
+    const auto& discrete = md->model_variables->by_variability(variability::discrete);
+    CHECK(1 == discrete.value_references.reals.size());
+    CHECK(1 == discrete.value_references.booleans.size());
+
+    // h and _D_whenCondition1 share valueReference 0, but not the base type
+    CHECK(1 == md->model_variables->aliases(0).size());
+
+    // der(h) depends on v, der(v) on nothing
+    const auto sparsity = md->get_jacobian_sparsity();
+    REQUIRE(2 == sparsity.rows());
+    REQUIRE(2 == sparsity.columns());
+    REQUIRE(1 == sparsity.non_zeros());
+    CHECK(1 == sparsity.column_vrs[sparsity.column_indices[0]]);
+    CHECK(1 == sparsity.num_colours);
+}
+
+TEST_CASE("ArrayVariables_select_by_array_index")
+{
+    const std::string path = "../resources/model_descriptions/ArrayVariables/modelDescription.xml";
+
+    auto md = parse_model_description(path);
+
+    // both bounds are inclusive, and every variable under an element is selected
+    auto motors = md->select_by_array_index("motor", 2, 3);
+    REQUIRE(2 == motors.reals.size());
+    CHECK(2 == motors.reals[0]);
+    CHECK(3 == motors.reals[1]);
+    REQUIRE(1 == motors.integers.size());
+    CHECK(5 == motors.integers[0]);
+
+    CHECK(std::vector<fmi2ValueReference>{1} == md->select_by_array_index("motor", 1, 1).reals);
+    CHECK(std::vector<fmi2ValueReference>{4} == md->select_by_array_index("motor", 10, 10).reals);
+    CHECK(md->select_by_array_index("motor", 4, 9).empty());
+
+    // motor.k has no index and motors[2] is another array
+    CHECK(5 == md->select_by_array_index("motor", 0, 100).size());
+
+    // the range applies to the first dimension
+    CHECK(std::vector<fmi2ValueReference>{8} == md->select_by_array_index("grid", 2, 2).reals);
+    CHECK(2 == md->select_by_array_index("grid", 0, 3).size());
+
+    const auto indices = md->model_variables->find_by_array_index("motor", 2, 2);
+    REQUIRE(2 == indices.size());
+    CHECK("motor[2].w" == (*md->model_variables)[indices[0]].name);
+    CHECK("motor[2].n" == (*md->model_variables)[indices[1]].name);
+}
+
+TEST_CASE("DirectFeedthrough_graph")
+{
+    const std::string path = "../resources/model_descriptions/DirectFeedthrough/modelDescription.xml";
+
+    auto md = parse_model_description(path);
+    const auto graph = md->get_feedthrough_graph();
+
+    REQUIRE(2 == graph.num_inputs());
+    CHECK(10 == graph.input_vrs[0]);
+    CHECK(12 == graph.input_vrs[1]);
+    CHECK(2 == graph.input_variables[1]);
+
+    REQUIRE(4 == graph.num_outputs());
+    CHECK(std::vector<fmi2ValueReference>{20, 21, 22, 23} == graph.output_vrs);
+
+    // y1 depends on u1, while the state and the parameter in its list are not inputs
+    CHECK(graph.has_feedthrough(0));
+    CHECK(graph.depends_on(0, 0));
+    CHECK(!graph.depends_on(0, 1));
+    CHECK(!graph.full_dependency[0]);
+
+    // y2 only depends on the state
+    CHECK(!graph.has_feedthrough(1));
+    CHECK(!graph.full_dependency[1]);
+
+    // y3 has no dependencies attribute, so it depends on every input
+    CHECK(graph.full_dependency[2]);
+    CHECK(graph.depends_on(2, 0));
+    CHECK(graph.depends_on(2, 1));
+
+    CHECK(graph.depends_on(3, 1));
+    CHECK(!graph.depends_on(3, 0));
+
+    CHECK(std::vector<size_t>{0, 1, 1, 3, 4} == graph.output_offsets);
+}
+
+TEST_CASE("UnitsAndTypes_definitions")
+{
+    const std::string path = "../resources/model_descriptions/UnitsAndTypes/modelDescription.xml";
+
+    auto md = parse_model_description(path);
+    const auto& units = *md->unit_definitions;
+    const auto& types = *md->type_definitions;
+
+    // the four defined units, then furlong, which a variable uses without defining it
+    REQUIRE(5 == units.size());
+    CHECK(1 == units.find("degC"));
+    CHECK(3 == units.find("bar"));
+    CHECK(4 == units.find("furlong"));
+    CHECK(!units[4].base_unit);
+    CHECK(1 == units.find_display_unit(3, "mbar"));
+
+    REQUIRE(3 == types.size());
+    CHECK(2 == types.find("Mode"));
+    CHECK(2 == types[2].items.size());
+    CHECK(1 == types[0].unit_id);
+    CHECK(0 == types[0].display_unit_id);
+
+    // unit and display unit come from the declared type
+    const auto temperature = md->get_variable_by_name("T_in").as_real();
+    CHECK(0 == temperature.declaredTypeId());
+    CHECK(1 == temperature.unitId());
+    CHECK(0 == temperature.displayUnitId());
+    CHECK("Temperature" == temperature.declaredType());
+    CHECK("degC" == temperature.unit());
+    CHECK("degF" == temperature.displayUnit());
+    CHECK(68.0 == Approx(units.to_display_unit(*temperature.unitId(), *temperature.displayUnitId()).apply(20.0)));
+    CHECK(293.15 == Approx(units.to_base_unit(*temperature.unitId()).apply(20.0)));
+
+    // the display unit of the variable overrides the one of the type
+    const auto pressure = md->get_variable_by_name("p").as_real();
+    CHECK(1 == pressure.declaredTypeId());
+    CHECK(3 == pressure.unitId());
+    CHECK(1 == pressure.displayUnitId());
+    CHECK("bar" == pressure.unit());
+    CHECK("mbar" == pressure.displayUnit());
+    CHECK(1500.0 == Approx(units.to_display_unit(*pressure.unitId(), *pressure.displayUnitId()).apply(1.5)));
+
+    CHECK(0 == md->get_variable_by_name("T_out").as_real().unitId());
+    CHECK(!md->get_variable_by_name("T_out").as_real().displayUnitId());
+    CHECK("K" == md->get_variable_by_name("T_out").as_real().unit());
+    CHECK(!md->get_variable_by_name("T_out").as_real().displayUnit());
+    CHECK(4 == md->get_variable_by_name("length").as_real().unitId());
+    CHECK("furlong" == md->get_variable_by_name("length").as_real().unit());
+    CHECK(2 == md->get_variable_by_name("mode").as_enumeration().declaredTypeId());
+    CHECK("Mode" == md->get_variable_by_name("mode").as_enumeration().declaredType());
+    CHECK(!md->get_variable_by_name("T_out").as_real().declaredType());
+
+    const auto toKelvin = units.conversion(*temperature.unitId(), 0);
+    REQUIRE(toKelvin);
+    CHECK(293.15 == Approx(toKelvin->apply(20.0)));
+    CHECK(20.0 == Approx(toKelvin->inverse().apply(293.15)));
+
+    const auto toPascal = units.conversion(*pressure.unitId(), 2);
+    REQUIRE(toPascal);
+    double values[3] = {0.5, 1.0, 2.0};
+    toPascal->apply(values, values, 3);
+    CHECK(50000.0 == Approx(values[0]));
+    CHECK(200000.0 == Approx(values[2]));
+
+    CHECK(!units.conversion(0, 3));
+}
+
+TEST_CASE("VendorAnnotations_streaming")
+{
+    // CDATA sections ending in ']' must still be closed by the streaming parser
+    const std::string path = "../resources/model_descriptions/VendorAnnotations/modelDescription.xml";
+
+    auto md = parse_model_description_streaming(path);
+    CHECK("VendorAnnotations" == md->model_name);
+    REQUIRE(1 == md->model_variables->size());
+    CHECK("y" == md->get_variable_by_name("y").name);
+    REQUIRE(1 == md->model_structure->outputs.size());
+    CHECK(1 == md->model_structure->outputs[0].index);
+}
+
+TEST_CASE("UnlistedDerivative_states")
+{
+    const std::string path = "../resources/model_descriptions/UnlistedDerivative/modelDescription.xml";
+
+    // der(u) has a derivative attribute, but only ModelStructure/Derivatives defines the states
+    for (const auto& md : {parse_model_description(path), parse_model_description_streaming(path)}) {
+        CHECK(1 == md->number_of_continuous_states());
+
+        const auto& states = md->model_variables->states();
+        REQUIRE(1 == states.indices.size());
+        CHECK(0 == states.indices[0]);
+        REQUIRE(1 == states.value_references.reals.size());
+        CHECK(1 == states.value_references.reals[0]);
+
+        const auto& derivatives = md->model_variables->derivatives();
+        REQUIRE(1 == derivatives.indices.size());
+        CHECK(1 == derivatives.indices[0]);
+        REQUIRE(1 == derivatives.value_references.reals.size());
+        CHECK(2 == derivatives.value_references.reals[0]);
+    }
 }
@@ -0,0 +1,57 @@
+
+#include <fmi4cpp/string_arena.hpp>
+
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>
+
+#include <string>
+
+using namespace fmi4cpp;
+
+TEST_CASE("string_arena_reuse")
+{
+    string_arena arena;
+
+    std::string value = "temperature";
+    const auto first = arena.store(1, value.c_str());
+    CHECK("temperature" == first);
+    CHECK(first.data() != value.data());
+
+    // the same value again keeps the stored copy, so earlier views stay valid
+    value.assign("temperature");
+    const auto second = arena.store(1, value.c_str());
+    CHECK(first.data() == second.data());
+    CHECK("temperature" == first);
+
+    // views of other value references are not affected by adding more
+    for (fmi4cppValueReference vr = 2; vr < 1000; vr++) {
+        arena.store(vr, "x");
+    }
+    CHECK(first.data() == arena.get(1).data());
+    CHECK("temperature" == first);
+    CHECK(999 == arena.size());
+}
+
+TEST_CASE("string_arena_changed_value")
+{
+    string_arena arena;
+
+    arena.store(1, "a fairly long first value");
+    arena.store(2, "other");
+
+    const auto changed = arena.store(1, "short");
+    CHECK("short" == changed);
+    CHECK("short" == arena.get(1));
+    CHECK("other" == arena.get(2));
+
+    const auto longer = arena.store(1, "a value longer than any stored before for this reference");
+    CHECK("a value longer than any stored before for this reference" == longer);
+    CHECK(longer.data() == arena.get(1).data());
+
+    CHECK(arena.store(3, nullptr).empty());
+    CHECK(arena.get(4).empty());
+
+    arena.clear();
+    CHECK(0 == arena.size());
+    CHECK(arena.get(1).empty());
+}
@@ -0,0 +1,65 @@
+
+#include <fmi4cpp/value_cache.hpp>
+
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>
+
+using namespace fmi4cpp;
+
+TEST_CASE("value_cache_large_value_references")
+{
+    // value references as exported by Dymola, with the type encoded in the high bits
+    const fmi4cppValueReference state = 33554432;
+    const fmi4cppValueReference parameter = 16777216;
+    const fmi4cppValueReference output = 335544320;
+
+    value_reference_set known;
+    known.reals = {output, state, parameter, state};
+    value_cache cache(known);
+
+    double value = 0;
+    CHECK(!cache.get<base_type::real>(state, value));
+
+    cache.put<base_type::real>(state, 1.0);
+    cache.put<base_type::real>(output, 2.0);
+    CHECK(cache.get<base_type::real>(state, value));
+    CHECK(1.0 == value);
+    CHECK(cache.get<base_type::real>(output, value));
+    CHECK(2.0 == value);
+    CHECK(!cache.get<base_type::real>(parameter, value));
+
+    // the types are kept apart
+    int integer = 0;
+    CHECK(!cache.get<base_type::integer>(state, integer));
+
+    const fmi4cppValueReference vrs[] = {output, state};
+    double values[2] = {};
+    CHECK(cache.get<base_type::real>(vrs, 2, values));
+    CHECK(2.0 == values[0]);
+    CHECK(1.0 == values[1]);
+
+    cache.invalidate();
+    CHECK(!cache.get<base_type::real>(state, value));
+    CHECK(!cache.get<base_type::real>(vrs, 2, values));
+}
+
+TEST_CASE("value_cache_unknown_value_references")
+{
+    // value references missing from the model description are cached all the same
+    value_reference_set known;
+    known.integers = {1, 3};
+    value_cache cache(known);
+
+    const fmi4cppValueReference vrs[] = {4026531840u, 2, 3};
+    const int values[] = {7, 8, 9};
+    cache.put<base_type::integer>(vrs, 3, values);
+
+    int value = 0;
+    CHECK(cache.get<base_type::integer>(4026531840u, value));
+    CHECK(7 == value);
+    CHECK(cache.get<base_type::integer>(2, value));
+    CHECK(8 == value);
+    CHECK(cache.get<base_type::integer>(3, value));
+    CHECK(9 == value);
+    CHECK(!cache.get<base_type::integer>(1, value));
+}
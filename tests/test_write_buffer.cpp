@@ -0,0 +1,131 @@
+
+#include <fmi4cpp/write_buffer.hpp>
+
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>
+
+#include <map>
+#include <string>
+
+using namespace fmi4cpp;
+
+namespace
+{
+
+// records what reaches it, and fails the calls for the base types marked as failing
+struct recording_target
+{
+    bool failIntegers = false;
+    std::map<fmi4cppValueReference, int> integers;
+    std::map<fmi4cppValueReference, double> reals;
+    std::map<fmi4cppValueReference, int> booleans;
+    std::map<fmi4cppValueReference, std::string> strings;
+    size_t calls = 0;
+
+    bool set_integer(const fmi4cppValueReference* vr, size_t nvr, const fmi4cppInteger* values)
+    {
+        calls++;
+        if (failIntegers) {
+            return false;
+        }
+        for (size_t i = 0; i < nvr; i++) {
+            integers[vr[i]] = values[i];
+        }
+        return true;
+    }
+
+    bool set_real(const fmi4cppValueReference* vr, size_t nvr, const fmi4cppReal* values)
+    {
+        calls++;
+        for (size_t i = 0; i < nvr; i++) {
+            reals[vr[i]] = values[i];
+        }
+        return true;
+    }
+
+    bool set_boolean(const fmi4cppValueReference* vr, size_t nvr, const fmi4cppBoolean* values)
+    {
+        calls++;
+        for (size_t i = 0; i < nvr; i++) {
+            booleans[vr[i]] = values[i];
+        }
+        return true;
+    }
+
+    bool set_string(const fmi4cppValueReference* vr, size_t nvr, const fmi4cppString* values)
+    {
+        calls++;
+        for (size_t i = 0; i < nvr; i++) {
+            strings[vr[i]] = values[i];
+        }
+        return true;
+    }
+};
+
+} // namespace
+
+TEST_CASE("write_buffer_last_write_wins")
+{
+    write_buffer buffer;
+    recording_target target;
+
+    buffer.write_real(1, 1.0);
+    buffer.write_real(2, 2.0);
+    buffer.write_real(1, 3.0);
+    buffer.write_string(1, "first");
+    buffer.write_string(1, "second");
+    CHECK(3 == buffer.size());
+
+    CHECK(buffer.flush(target));
+    CHECK(buffer.empty());
+    CHECK(2 == target.calls);
+    CHECK(3.0 == target.reals[1]);
+    CHECK(2.0 == target.reals[2]);
+    CHECK("second" == target.strings[1]);
+
+    // written again after the flush, only the new writes are passed on
+    target.reals.clear();
+    buffer.write_real(2, 4.0);
+    buffer.write_real(3, 5.0);
+    CHECK(2 == buffer.size());
+    CHECK(buffer.flush(target));
+    CHECK(2 == target.reals.size());
+    CHECK(4.0 == target.reals[2]);
+    CHECK(5.0 == target.reals[3]);
+}
+
+TEST_CASE("write_buffer_failed_call")
+{
+    write_buffer buffer;
+    recording_target target;
+    target.failIntegers = true;
+
+    buffer.write_integer(1, 1);
+    buffer.write_real(2, 2.0);
+    buffer.write_boolean(3, true);
+    buffer.write_string(4, "four");
+
+    // the failing integer call does not keep the other types from being written
+    CHECK(!buffer.flush(target));
+    CHECK(4 == target.calls);
+    CHECK(2.0 == target.reals[2]);
+    CHECK(target.booleans[3]);
+    CHECK("four" == target.strings[4]);
+    CHECK(buffer.empty());
+}
+
+TEST_CASE("write_buffer_clear")
+{
+    write_buffer buffer;
+    recording_target target;
+
+    buffer.write_integer(1, 1);
+    buffer.clear();
+    CHECK(buffer.empty());
+    CHECK(buffer.flush(target));
+    CHECK(0 == target.calls);
+
+    buffer.write_integer(1, 2);
+    CHECK(buffer.flush(target));
+    CHECK(2 == target.integers[1]);
+}
@@ -0,0 +1,268 @@
+#include <fmi4cpp/fmi4cpp.hpp>
+
+#include <cctype>
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace fmi4cpp;
+
+namespace
+{
+
+const std::set<std::string> keywords = {
+    "alignas", "alignof", "and", "and_eq", "asm", "auto", "bitand", "bitor", "bool", "break", "case", "catch",
+    "char", "class", "compl", "const", "constexpr", "const_cast", "continue", "decltype", "default", "delete",
+    "do", "double", "dynamic_cast", "else", "enum", "explicit", "export", "extern", "false", "float", "for",
+    "friend", "goto", "if", "inline", "int", "long", "mutable", "namespace", "new", "noexcept", "not", "not_eq",
+    "nullptr", "operator", "or", "or_eq", "private", "protected", "public", "register", "reinterpret_cast",
+    "return", "short", "signed", "sizeof", "static", "static_assert", "static_cast", "struct", "switch",
+    "template", "this", "thread_local", "throw", "true", "try", "typedef", "typeid", "typename", "union",
+    "unsigned", "using", "virtual", "void", "volatile", "wchar_t", "while", "xor", "xor_eq"};
+
+/**
+ * Turns a variable name such as "der(body.v[1])" into a valid and unique C++ identifier.
+ */
+std::string to_identifier(const std::string& name, std::set<std::string>& used)
+{
+    std::string id;
+    for (const char c : name) {
+        if (std::isalnum(static_cast<unsigned char>(c))) {
+            id.push_back(c);
+        } else if (id.empty() || id.back() != '_') {
+            id.push_back('_');
+        }
+    }
+    while (id.size() > 1 && id.back() == '_') {
+        id.pop_back();
+    }
+    // identifiers starting with '_' followed by an uppercase letter are reserved
+    if (id.empty() || id[0] == '_' || std::isdigit(static_cast<unsigned char>(id[0]))) {
+        id.insert(0, "v");
+    }
+    if (keywords.count(id)) {
+        id.push_back('_');
+    }
+
+    auto unique = id;
+    for (int i = 2; used.count(unique); i++) {
+        unique = id + "_" + std::to_string(i);
+    }
+    used.insert(unique);
+    return unique;
+}
+
+std::string typed_vr_name(const fmi2::scalar_variable& v)
+{
+    if (v.is_real()) {
+        return "fmi4cpp::real_vr";
+    } else if (v.is_boolean()) {
+        return "fmi4cpp::boolean_vr";
+    } else if (v.is_string()) {
+        return "fmi4cpp::string_vr";
+    }
+    return "fmi4cpp::integer_vr";
+}
+
+std::string escape(const std::string& str)
+{
+    std::string escaped;
+    for (const char c : str) {
+        if (c == '"' || c == '\\') {
+            escaped.push_back('\\');
+        }
+        escaped.push_back(c);
+    }
+    return escaped;
+}
+
+struct base_type_names
+{
+    const char* group;
+    const char* type;
+    const char* value_type;
+};
+
+// in the order of the fields of value_reference_set
+const base_type_names names[] = {
+    {"integers", "fmi4cpp::base_type::integer", "fmi4cpp::fmi4cppInteger"},
+    {"reals", "fmi4cpp::base_type::real", "fmi4cpp::fmi4cppReal"},
+    {"booleans", "fmi4cpp::base_type::boolean", "fmi4cpp::fmi4cppBoolean"},
+    {"strings", "fmi4cpp::base_type::string", "fmi4cpp::fmi4cppString"}};
+
+size_t base_type_index(const fmi2::scalar_variable& v)
+{
+    if (v.is_real()) {
+        return 1;
+    } else if (v.is_boolean()) {
+        return 2;
+    } else if (v.is_string()) {
+        return 3;
+    }
+    return 0;
+}
+
+void write_vrs(std::ostream& out, const char* name, const std::vector<fmi4cppValueReference>& vrs)
+{
+    out << "inline constexpr std::array<fmi4cpp::fmi4cppValueReference, " << vrs.size() << "> " << name << " = {";
+    for (size_t i = 0; i < vrs.size(); i++) {
+        out << (i == 0 ? "" : ", ") << vrs[i];
+    }
+    out << "};\n";
+}
+
+/**
+ * Writes the value references of a group split by base type, a struct with a field per variable of the group,
+ * and read (and for writable groups write) functions that move all of them with one call per base type.
+ */
+void write_group(std::ostream& out, const std::string& name, const fmi2::model_variables& variables,
+    const fmi2::variable_partition& partition, const std::vector<std::string>& ids, bool writable)
+{
+    const auto& set = partition.value_references;
+    const std::vector<fmi4cppValueReference>* vrs[] = {&set.integers, &set.reals, &set.booleans, &set.strings};
+
+    // the fields of each base type, in the order of their value references
+    std::vector<std::string> fields[4];
+    for (const auto index : partition.indices) {
+        fields[base_type_index(variables[index])].push_back(ids[index]);
+    }
+
+    out << "namespace " << name << "\n{\n";
+    for (size_t t = 0; t < 4; t++) {
+        write_vrs(out, names[t].group, *vrs[t]);
+    }
+
+    out << "\nstruct values\n{\n";
+    for (size_t t = 0; t < 4; t++) {
+        for (const auto& field : fields[t]) {
+            out << "    " << names[t].value_type << " " << field << ";\n";
+        }
+    }
+    out << "};\n";
+
+    // the parameters are left unnamed for groups without variables
+    const bool empty = partition.indices.empty();
+    out << "\ninline bool read(fmi4cpp::fmu_reader&" << (empty ? "" : " reader") << ", values&" << (empty ? "" : " v")
+        << ")\n{\n";
+    for (size_t t = 0; t < 4; t++) {
+        if (fields[t].empty()) {
+            continue;
+        }
+        out << "    std::array<" << names[t].value_type << ", " << fields[t].size() << "> " << names[t].group << ";\n";
+        out << "    if (!fmi4cpp::read<" << names[t].type << ">(reader, " << name << "::" << names[t].group << ", "
+            << names[t].group << ")) {\n";
+        out << "        return false;\n";
+        out << "    }\n";
+        for (size_t i = 0; i < fields[t].size(); i++) {
+            out << "    v." << fields[t][i] << " = " << names[t].group << "[" << i << "];\n";
+        }
+    }
+    out << "    return true;\n}\n";
+
+    if (writable) {
+        out << "\ninline bool write(fmi4cpp::fmu_writer&" << (empty ? "" : " writer") << ", const values&"
+            << (empty ? "" : " v") << ")\n{\n";
+        for (size_t t = 0; t < 4; t++) {
+            if (fields[t].empty()) {
+                continue;
+            }
+            out << "    const std::array<" << names[t].value_type << ", " << fields[t].size() << "> " << names[t].group << " = {";
+            for (size_t i = 0; i < fields[t].size(); i++) {
+                out << (i == 0 ? "" : ", ") << "v." << fields[t][i];
+            }
+            out << "};\n";
+            out << "    if (!fmi4cpp::write<" << names[t].type << ">(writer, " << name << "::" << names[t].group << ", "
+                << names[t].group << ")) {\n";
+            out << "        return false;\n";
+            out << "    }\n";
+        }
+        out << "    return true;\n}\n";
+    }
+    out << "} // namespace " << name << "\n\n";
+}
+
+std::string generate(const fmi2::model_description& md, const std::string& ns)
+{
+    const auto& variables = *md.model_variables;
+
+    std::ostringstream out;
+    out << "// Generated by fmi4cpp_codegen from the model description of '" << md.model_name << "', do not edit.\n\n";
+    out << "#pragma once\n\n";
+    out << "#include <fmi4cpp/typed_access.hpp>\n\n";
+    out << "#include <array>\n\n";
+    out << "namespace " << ns << "\n{\n\n";
+    out << "inline constexpr const char* model_name = \"" << escape(md.model_name) << "\";\n";
+    out << "inline constexpr const char* guid = \"" << escape(md.guid) << "\";\n\n";
+
+    std::set<std::string> used;
+    std::vector<std::string> ids;
+    ids.reserve(variables.size());
+    out << "namespace vr\n{\n";
+    for (const auto& v : variables) {
+        ids.push_back(to_identifier(v.name, used));
+        out << "constexpr " << typed_vr_name(v) << " " << ids.back() << "{" << v.value_reference << "};\n";
+    }
+    out << "} // namespace vr\n\n";
+
+    write_group(out, "inputs", variables, variables.by_causality(fmi2::causality::input), ids, true);
+    write_group(out, "outputs", variables, variables.by_causality(fmi2::causality::output), ids, false);
+    write_group(out, "parameters", variables, variables.by_causality(fmi2::causality::parameter), ids, true);
+
+    out << "} // namespace " << ns << "\n";
+    return out.str();
+}
+
+} // namespace
+
+/**
+ * Usage: fmi4cpp_codegen <modelDescription.xml|model.fmu> <output header> [namespace]
+ */
+int main(int argc, char** argv)
+{
+    if (argc < 3) {
+        std::cerr << "Usage: " << argv[0] << " <modelDescription.xml|model.fmu> <output header> [namespace]" << std::endl;
+        return 1;
+    }
+
+    const std::string input = argv[1];
+    const std::string output = argv[2];
+
+    try {
+        std::shared_ptr<const fmi2::model_description> md;
+        if (input.size() >= 4 && input.compare(input.size() - 4, 4, ".fmu") == 0) {
+            md = fmi2::fmu(input).get_model_description();
+        } else {
+            md = fmi2::parse_model_description(input);
+        }
+
+        std::set<std::string> used;
+        const std::string ns = argc > 3 ? argv[3] : to_identifier(md->model_name, used);
+
+        const auto header = generate(*md, ns);
+
+        // leave an unchanged header alone, so dependent sources are not rebuilt
+        std::ifstream existing(output);
+        if (existing) {
+            std::ostringstream current;
+            current << existing.rdbuf();
+            if (current.str() == header) {
+                return 0;
+            }
+        }
+
+        std::ofstream out(output);
+        out << header;
+        if (!out) {
+            std::cerr << "Unable to write '" << output << "'" << std::endl;
+            return 1;
+        }
+    } catch (const std::exception& ex) {
+        std::cerr << ex.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}